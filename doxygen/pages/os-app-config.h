@@ -359,6 +359,16 @@
  */
 #define OS_INTEGER_RTOS_IDLE_STACK_SIZE_BYTES
 
+/**
+ * @brief Define the **timer** daemon thread stack size.
+ *
+ * @details
+ * Used only when @ref OS_INCLUDE_RTOS_TIMER_DAEMON is defined.
+ *
+ * @note Ignored for synthetic platforms.
+ */
+#define OS_INTEGER_RTOS_TIMER_DAEMON_STACK_SIZE_BYTES
+
 /**
  * @brief Include statistics to count thread CPU cycles.
  *
@@ -384,6 +394,37 @@
  */
 #define OS_INCLUDE_RTOS_STATISTICS_THREAD_CPU_CYCLES	(1)
 
+/**
+ * @brief Include statistics for the clock expiry critical sections.
+ *
+ * @details
+ * Measure, with the high resolution clock, each critical section
+ * entered while processing the expired clock time stamps, and
+ * keep the maximum, the worst case time spent with interrupts masked.
+ *
+ * @see os::rtos::scheduler::statistics::clock_expiry_max_masked_cycles()
+ *
+ * @par Default
+ * Disable. Do not include clock expiry statistics.
+ */
+#define OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY	(1)
+
+/**
+ * @brief Include statistics for the timer daemon.
+ *
+ * @details
+ * Keep track of the number of timers waiting for the timer
+ * daemon, of its maximum, and of the longest delay between a timer
+ * expiry and the call of its function.
+ *
+ * @see os::rtos::timer_daemon::statistics::max_queue_depth()
+ * @see os::rtos::timer_daemon::statistics::max_dispatch_delay()
+ *
+ * @par Default
+ * Disable. Do not include timer daemon statistics.
+ */
+#define OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON	(1)
+
 /**
  * @brief Include statistics to count thread context switches.
  *
@@ -406,6 +447,30 @@
  */
 #define OS_INCLUDE_RTOS_STATISTICS_THREAD_CONTEXT_SWITCHES
 
+/**
+ * @brief Include contention and hold time statistics for mutexes.
+ *
+ * @details
+ * For each mutex, count the acquisitions and the acquisitions
+ * that had to wait, measure with the high resolution clock the
+ * total and the maximum wait and hold times, and count the
+ * priority inheritance boosts. Recursive relocks are not counted.
+ *
+ * All mutexes are kept in a list, which can be enumerated with
+ * os::rtos::mutex::statistics_mutexes(), or dumped with
+ * os::rtos::mutex::trace_print_all_statistics().
+ *
+ * The RAM overhead is a pair of list links and seven 64-bit
+ * counters for each mutex. The time overhead is two clock samplings
+ * for each acquisition and release.
+ *
+ * @see os::rtos::mutex::statistics
+ *
+ * @par Default
+ * Disable. Do not include mutex statistics.
+ */
+#define OS_INCLUDE_RTOS_STATISTICS_MUTEX
+
 /**
  * @brief Add a user defined storage to each thread.
  */
@@ -426,6 +491,50 @@
  */
 #define OS_BOOL_RTOS_MESSAGE_QUEUE_SIZE_16BITS  (false)
 
+/**
+ * @brief Use a bitmap indexed message queue priority list.
+ *
+ * @details
+ * By default, sending a message walks the queue backwards from
+ * the tail until a message with the same or higher priority
+ * is found, so the time spent with interrupts disabled grows
+ * with the number of queued messages of lower priorities.
+ *
+ * With this option, each queue keeps the index of the last
+ * message of each priority and a two level bitmap of the
+ * priorities with queued messages, and the insertion point is
+ * found with two count-trailing-zeros instructions. Messages
+ * with the same priority remain in FIFO order.
+ *
+ * The cost is an additional RAM footprint of 256 indices
+ * and 9 bitmap words for each message queue.
+ *
+ * @par Default
+ *  Not defined (walk the priority ordered list).
+ */
+#define OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP
+
+/**
+ * @brief Define the largest message size copied directly between threads.
+ *
+ * @details
+ * The message queues copy the message payloads with interrupts
+ * enabled, so the time spent in critical sections does not
+ * depend on the message size.
+ *
+ * The exception is the direct transfer between a sender and a
+ * waiting receiver (or between a receiver and a waiting sender),
+ * where the copy is done with interrupts disabled; this option
+ * limits such transfers to queues with messages up to this size,
+ * larger messages always go through the queue storage.
+ *
+ * Use 0 to disable the direct transfers.
+ *
+ * @par Default
+ *  64.
+ */
+#define OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES
+
 /**
  * @brief Push down the idle thread priority.
  *
@@ -472,6 +581,312 @@
  */
 #define OS_BOOL_RTOS_SCHEDULER_PREEMPTIVE (true)
 
+/**
+ * @brief Include round robin time slicing for threads
+ *  with the same priority.
+ *
+ * @details
+ * By default, a running thread is moved behind the ready threads
+ * with the same priority at each rescheduling, and
+ * a higher priority thread preempting it also makes it lose its place.
+ *
+ * With this option, each thread has a time slice, counted in
+ * system clock ticks and set via
+ * `thread::attributes::th_quantum_ticks`. A thread preempted
+ * before its time slice expires is resumed before its peers; when
+ * the time slice expires, or the thread calls `this_thread::yield()`,
+ * the thread is moved behind the ready threads with the same
+ * priority and gets a new time slice.
+ *
+ * Threads with a time slice of 0 are not subject to time slicing.
+ *
+ * Available only with the native scheduler.
+ */
+#define OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN
+
+/**
+ * @brief Define the default thread time slice, in system clock ticks.
+ *
+ * @details
+ * Used to initialise `thread::attributes::th_quantum_ticks` when
+ * `OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN` is defined.
+ *
+ * @par Default
+ *  10 ticks.
+ */
+#define OS_INTEGER_RTOS_THREAD_QUANTUM_TICKS (10)
+
+/**
+ * @brief Use a bitmap indexed ready threads list.
+ *
+ * @details
+ * By default the ready threads are kept in a single list,
+ * ordered by priority; inserting a thread walks the list
+ * backwards until the proper position is found, so the time
+ * spent with interrupts disabled grows with the number of
+ * ready threads.
+ *
+ * With this option, the ready threads are kept in separate
+ * FIFO lists, one for each priority level, and a two level
+ * bitmap identifies the highest non-empty list with two
+ * count-leading-zeros instructions. All ready list operations
+ * become constant time.
+ *
+ * The cost is an additional RAM footprint of 256 list heads
+ * (2 KB on 32-bit platforms) and 9 bitmap words.
+ *
+ * @par Default
+ *  Not defined (use the priority ordered list).
+ */
+#define OS_USE_RTOS_READY_LIST_BITMAP
+
+/**
+ * @brief Use a hierarchical timing wheel for the clock lists.
+ *
+ * @details
+ * By default, the clock time stamps (timeouts, sleeps, timers)
+ * are kept in ordered lists, and each insertion walks the list
+ * in a critical section, so the cost grows with the number of
+ * outstanding time stamps.
+ *
+ * With this option, the future time stamps are kept in a
+ * hierarchical timing wheel with 4 levels of 64 slots,
+ * which makes insertion and removal constant time, and
+ * expiry amortised constant time. The order in which the
+ * actions are performed does not change.
+ *
+ * The cost is an additional RAM footprint of about 2 KB
+ * (on 32-bit platforms) for each clock list.
+ *
+ * @par Default
+ *  Not defined (use ordered lists).
+ */
+#define OS_USE_RTOS_CLOCK_TIMING_WHEEL
+
+/**
+ * @brief Use batched expiry for the clock lists.
+ *
+ * @details
+ * By default, the expired clock time stamps are processed one
+ * at a time, each in its own critical section, and each resumed
+ * thread may invoke the scheduler.
+ *
+ * With this option, all due nodes are detached in a single pass,
+ * the waiting threads are made ready in the same critical section
+ * and the scheduler is invoked once; the timer actions are
+ * performed afterwards, in order.
+ *
+ * The threads are resumed before the timer actions with the same
+ * time stamp are performed.
+ *
+ * @par Default
+ *  Not defined (process the expired nodes one at a time).
+ */
+#define OS_USE_RTOS_CLOCK_BATCH_EXPIRY
+
+/**
+ * @brief Include support for timeouts with tolerance.
+ *
+ * @details
+ * Add the `clock::sleep_for()` and `clock::wait_for()` variants
+ * with a slack parameter and the timer `tm_slack` attribute.
+ *
+ * Deadlines with tolerance are moved later, within the slack
+ * window, to time stamps aligned to the largest power of two not above
+ * the slack plus one, so deadlines close to each other are
+ * fired together, with a single wake-up and context switch.
+ * Combined with the tickless idle mode, this reduces the number
+ * of wake-ups of mostly idle systems.
+ *
+ * Periodic timers keep the exact time stamps internally, so the
+ * tolerance does not accumulate drift.
+ *
+ * @par Default
+ *  Not defined (all deadlines are exact).
+ */
+#define OS_INCLUDE_RTOS_CLOCK_SLACK
+
+/**
+ * @brief Read the clocks without masking interrupts.
+ *
+ * @details
+ * By default, the 64-bit clock counts (and the adjustable clocks
+ * offset) are read in critical sections, to prevent torn values.
+ *
+ * With this option, all updates increment a sequence counter
+ * before and after changing the values, and readers retry if the
+ * counter was odd or changed while reading, so `now()`,
+ * `steady_now()` and `hrclock.now()` never mask interrupts.
+ *
+ * The updates are still done in critical sections, so this is
+ * intended for single core devices; the clocks must not be
+ * read from interrupts with priorities above
+ * @ref OS_INTEGER_RTOS_CRITICAL_SECTION_INTERRUPT_PRIORITY.
+ *
+ * The `test/clock-bench` application compares the per call cost
+ * of both paths.
+ *
+ * @par Default
+ *  Not defined (read the clocks in critical sections).
+ */
+#define OS_USE_RTOS_CLOCK_SEQLOCK
+
+/**
+ * @brief Include the binary scheduler events trace.
+ *
+ * @details
+ * Record context switches, thread resumes, waiting list
+ * link/unlink, clock ticks, timer expiries and, when the application calls
+ * `os::rtos::evtrace::isr_enter()` and `isr_exit()`, interrupt
+ * handlers, as fixed size binary records, in a RAM ring buffer.
+ *
+ * Unlike the `OS_TRACE_RTOS_*` options, recording an event only
+ * stores 16 bytes and does not mask interrupts, so the trace can
+ * stay enabled in production builds; with
+ * @ref OS_USE_RTOS_CLOCK_SEQLOCK the high resolution timestamp
+ * is also read without a critical section.
+ *
+ * The ring can be dumped with the debugger and converted to a
+ * timeline with `scripts/evtrace-decode.py`. Alternatively,
+ * `os::rtos::evtrace::write_json()` exports it, with the thread
+ * names, as Chrome Trace Event JSON (viewable in Perfetto); in
+ * synthetic POSIX builds it can be called with any `fopen()` file.
+ *
+ * @par Default
+ *  Not defined (no binary trace).
+ */
+#define OS_INCLUDE_RTOS_EVTRACE
+
+/**
+ * @brief Define the number of records in the events trace ring.
+ *
+ * @details
+ * Each record takes 16 bytes; must be a power of two, so that
+ * the ring keeps its order when the 32-bit head count wraps.
+ *
+ * @par Default
+ *  256.
+ */
+#define OS_INTEGER_RTOS_EVTRACE_RECORDS
+
+/**
+ * @brief Define the maximum number of objects in a wait set.
+ *
+ * @details
+ * Each object takes a waiting node in the `os::rtos::wait_set`
+ * object, so the set size grows with this value.
+ *
+ * @par Default
+ *  8.
+ */
+#define OS_INTEGER_RTOS_WAIT_SET_MAX_OBJECTS
+
+/**
+ * @brief Define the size of a data cache line.
+ *
+ * @details
+ * Used to place on separate cache lines the variables written by
+ * different parties, like the head and the tail indices of a
+ * lock free queue.
+ *
+ * @see os::rtos::spsc_queue
+ *
+ * @par Default
+ *  32.
+ */
+#define OS_INTEGER_RTOS_CACHE_LINE_SIZE_BYTES
+
+/**
+ * @brief Run the timer functions on a daemon thread.
+ *
+ * @details
+ * By default, the timer functions are called from the clock
+ * interrupt, in a critical section, so any non trivial function
+ * increases the interrupts latency of the whole system.
+ *
+ * With this option, the clock interrupt only moves the expired
+ * timers to a list and notifies the timer daemon, a thread
+ * which calls the timer functions, in batches, with interrupts enabled.
+ *
+ * Timers with very short functions can still be called from the
+ * clock interrupt, by setting the `tm_in_isr` attribute.
+ *
+ * @note Ignored when @ref OS_USE_RTOS_PORT_TIMER is defined.
+ *
+ * @par Default
+ *  Not defined (call the timer functions from the clock interrupt).
+ */
+#define OS_INCLUDE_RTOS_TIMER_DAEMON
+
+/**
+ * @brief Define the timer daemon thread priority.
+ *
+ * @details
+ * Used only when @ref OS_INCLUDE_RTOS_TIMER_DAEMON is defined.
+ *
+ * @par Default
+ *  `os::rtos::thread::priority::high`.
+ */
+#define OS_INTEGER_RTOS_TIMER_DAEMON_PRIORITY
+
+/**
+ * @brief Include the tickless idle mode.
+ *
+ * @details
+ * By default the system clock interrupt is taken on every tick,
+ * even when all threads are sleeping for long periods.
+ *
+ * With this option, when the idle thread runs, it identifies the
+ * earliest clock deadline and calls the
+ * `os_rtos_idle_suppress_ticks_hook()` to sleep with the
+ * ticks suppressed up to that deadline; on wake-up, the
+ * ticks elapsed while sleeping are credited to the clocks in one step.
+ *
+ * The hook must be implemented by the port or by the application;
+ * the default implementation does not suppress ticks.
+ *
+ * When the RTC is simulated from the system clock, the idle
+ * thread wakes up at least once per second.
+ *
+ * @par Default
+ *  Not defined (the system clock ticks are never suppressed).
+ */
+#define OS_INCLUDE_RTOS_TICKLESS_IDLE
+
+/**
+ * @brief Define the minimum number of ticks to suppress.
+ *
+ * @details
+ * If the earliest clock deadline is closer, the idle thread
+ * simply waits for the next interrupt, since reprogramming the
+ * timer is not worth it.
+ *
+ * @par Default
+ *  2 ticks.
+ */
+#define OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS (2)
+
+/**
+ * @brief Lock and unlock uncontended mutexes without critical sections.
+ *
+ * @details
+ * For `normal` and `errorcheck` mutexes, non-robust, with
+ * the `none` or `inherit` protocol, `lock()`, `try_lock()`,
+ * `timed_lock()` and `unlock()` first try a single
+ * compare-and-swap on the owner word; the scheduler critical
+ * section and the protocol, robustness and recursion logic are
+ * used only when the mutex is contended.
+ *
+ * The port must support the GCC `__atomic` builtins for
+ * pointers (on Cortex-M, ARMv7-M or higher).
+ *
+ * @note Ignored when @ref OS_USE_RTOS_PORT_MUTEX is defined.
+ *
+ * @par Default
+ *  Not defined (always use the critical sections).
+ */
+#define OS_USE_RTOS_MUTEX_FAST_PATH
+
 /**
  * @brief Do not enter sleep in the idle thread.
  *
@@ -767,6 +1182,21 @@
  */
 #define OS_TRACE_RTOS_CONDVAR
 
+/**
+ * @brief Enable trace messages for RTOS read-write locks functions.
+ */
+#define OS_TRACE_RTOS_RWLOCK
+
+/**
+ * @brief Enable trace messages for RTOS wait sets functions.
+ */
+#define OS_TRACE_RTOS_WAITSET
+
+/**
+ * @brief Enable trace messages for RTOS lock free queues functions.
+ */
+#define OS_TRACE_RTOS_MPMCQUEUE
+
 /**
  * @brief Enable trace messages for RTOS event flags functions.
  */
@@ -1092,6 +1092,7 @@ struct { \
       void* queue[items]; \
       os_mqueue_index_t links[2 * items]; \
       os_mqueue_prio_t prios[items]; \
+      uint8_t states[items]; \
     } storage; \
 } os_messageQ_##name; \
 const osMessageQDef_t os_messageQ_def_##name = { \
@@ -1194,6 +1195,7 @@ struct { \
       void* queue[items]; \
       os_mqueue_index_t links[2 * items]; \
       os_mqueue_prio_t prios[items]; \
+      uint8_t states[items]; \
     } queue_storage; \
 } os_mailQ_##name; \
 const osMailQDef_t os_mailQ_def_##name = { \
@@ -1217,6 +1219,7 @@ struct { \
       void* queue[items]; \
       os_mqueue_index_t links[2 * items]; \
       os_mqueue_prio_t prios[items]; \
+      uint8_t states[items]; \
     } queue_storage; \
 } os_mailQ_##name; \
 const osMailQDef_t os_mailQ_def_##name = { \
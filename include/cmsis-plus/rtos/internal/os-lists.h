@@ -49,9 +49,12 @@ namespace os
   namespace rtos
   {
     class thread;
+    class mutex;
 
     namespace internal
     {
+      class event_flags;
+
       // ======================================================================
 
 #pragma GCC diagnostic push
@@ -69,6 +72,13 @@ namespace os
          * @{
          */
 
+        /**
+         * @brief Construct a node not yet associated with a thread.
+         * @par Parameters
+         *  None.
+         */
+        waiting_thread_node ();
+
         /**
          * @brief Construct a node with references to the thread.
          * @param th Reference to the thread.
@@ -120,6 +130,329 @@ namespace os
 
       // ======================================================================
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpadded"
+
+      /**
+       * @brief Double linked list node, with thread reference and
+       *  the amount requested by the waiting thread.
+       * @details
+       * Common base of the nodes linked to the lists of semaphores
+       * and message queues, which may satisfy the request on behalf
+       * of the waiting thread, before resuming it.
+       */
+      class waiting_request_node : public waiting_thread_node
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a node not yet associated with a thread.
+         * @par Parameters
+         *  None.
+         */
+        waiting_request_node ();
+
+        /**
+         * @brief Construct a node with references to the thread.
+         * @param th Reference to the thread.
+         * @param request The requested amount.
+         */
+        waiting_request_node (thread& th, std::size_t request);
+
+        /**
+         * @cond ignore
+         */
+
+        waiting_request_node (const waiting_request_node&) = delete;
+        waiting_request_node (waiting_request_node&&) = delete;
+        waiting_request_node&
+        operator= (const waiting_request_node&) = delete;
+        waiting_request_node&
+        operator= (waiting_request_node&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the node.
+         */
+        ~waiting_request_node ();
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Variables
+         * @{
+         */
+
+        /**
+         * @brief The requested amount: the number of units for
+         *  a semaphore, the size of the message buffer, in bytes,
+         *  for a message queue.
+         * @details
+         * Zero when nothing can be handed over directly, like for
+         * the nodes of a `wait_set` or of a zero-copy wait; only
+         * `waiting_message_node` have a non-zero message request.
+         */
+        std::size_t request_;
+
+        /**
+         * @brief Set when the request was satisfied on behalf of
+         *  the waiting thread.
+         */
+        bool satisfied_ = false;
+
+        /**
+         * @}
+         */
+      };
+
+      // ======================================================================
+
+      /**
+       * @brief Double linked list node, with thread reference and
+       *  the expected event flags.
+       * @details
+       * The nodes of a `wait_set` are also linked to the lists of
+       * semaphores and message queues, so they request nothing.
+       */
+      class waiting_flags_node : public waiting_request_node
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a node not yet associated with a thread.
+         * @par Parameters
+         *  None.
+         */
+        waiting_flags_node ();
+
+        /**
+         * @brief Construct a node with references to the thread.
+         * @param th Reference to the thread.
+         * @param mask The expected flags.
+         * @param mode Mode bits to select if either all or any flags
+         *  are expected, and if the flags should be cleared.
+         */
+        waiting_flags_node (thread& th, flags::mask_t mask,
+                            flags::mode_t mode);
+
+        /**
+         * @cond ignore
+         */
+
+        waiting_flags_node (const waiting_flags_node&) = delete;
+        waiting_flags_node (waiting_flags_node&&) = delete;
+        waiting_flags_node&
+        operator= (const waiting_flags_node&) = delete;
+        waiting_flags_node&
+        operator= (waiting_flags_node&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the node.
+         */
+        ~waiting_flags_node ();
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Variables
+         * @{
+         */
+
+        /**
+         * @brief The expected flags.
+         */
+        flags::mask_t mask_;
+
+        /**
+         * @brief The flags returned to the thread, when satisfied.
+         */
+        flags::mask_t raised_ = 0;
+
+        /**
+         * @brief The wait mode.
+         */
+        flags::mode_t mode_;
+
+        /**
+         * @}
+         */
+      };
+
+      // ======================================================================
+
+      /**
+       * @brief Double linked list node, with thread reference and
+       *  the message buffer of a message queue send or receive.
+       * @details
+       * The inherited `request_` holds the size of the buffer, in
+       * bytes, or zero without a buffer (for a zero-copy wait).
+       * The inherited `satisfied_` is set when the peer completed
+       * the transfer on behalf of the waiting thread.
+       */
+      class waiting_message_node : public waiting_request_node
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a node with references to the thread.
+         * @param th Reference to the thread.
+         * @param msg Pointer to the message buffer, or `nullptr`.
+         * @param nbytes The size of the buffer.
+         * @param prio The message priority (for senders).
+         */
+        waiting_message_node (thread& th, void* msg, std::size_t nbytes,
+                              uint8_t prio);
+
+        /**
+         * @cond ignore
+         */
+
+        waiting_message_node (const waiting_message_node&) = delete;
+        waiting_message_node (waiting_message_node&&) = delete;
+        waiting_message_node&
+        operator= (const waiting_message_node&) = delete;
+        waiting_message_node&
+        operator= (waiting_message_node&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the node.
+         */
+        ~waiting_message_node ();
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Variables
+         * @{
+         */
+
+        /**
+         * @brief Pointer to the message buffer.
+         */
+        void* msg_;
+
+        /**
+         * @brief The message priority (a `message_queue::priority_t`).
+         */
+        uint8_t prio_;
+
+        /**
+         * @}
+         */
+      };
+
+#pragma GCC diagnostic pop
+
+      // ======================================================================
+
+      /**
+       * @brief Double linked list node, with thread reference and
+       *  the mutex associated with a condition variable wait.
+       */
+      class waiting_condvar_node : public waiting_thread_node
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a node with references to the thread
+         *  and to the mutex.
+         * @param th Reference to the thread.
+         * @param mx Reference to the mutex to be reacquired.
+         */
+        waiting_condvar_node (thread& th, rtos::mutex& mx);
+
+        /**
+         * @cond ignore
+         */
+
+        waiting_condvar_node (const waiting_condvar_node&) = delete;
+        waiting_condvar_node (waiting_condvar_node&&) = delete;
+        waiting_condvar_node&
+        operator= (const waiting_condvar_node&) = delete;
+        waiting_condvar_node&
+        operator= (waiting_condvar_node&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the node.
+         */
+        ~waiting_condvar_node ();
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Variables
+         * @{
+         */
+
+        /**
+         * @brief Pointer to the mutex released by the waiting thread.
+         */
+        rtos::mutex* mutex_;
+
+        /**
+         * @brief Set when removed from the list by `signal()`
+         *  or `broadcast()`.
+         */
+        bool signalled_ = false;
+
+        /**
+         * @}
+         */
+      };
+
+      // ======================================================================
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpadded"
 
@@ -183,6 +516,20 @@ namespace os
         virtual void
         action (void) = 0;
 
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+        /**
+         * @brief Get the thread to resume when the time stamp is reached.
+         * @par Parameters
+         *  None.
+         * @return Pointer to the thread, or `nullptr` if the
+         *  action must be performed.
+         */
+        virtual rtos::thread*
+        waiting_thread (void);
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+
         /**
          * @}
          */
@@ -273,6 +620,19 @@ namespace os
         virtual void
         action (void) override;
 
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+        /**
+         * @brief Get the thread to resume when the time stamp is reached.
+         * @par Parameters
+         *  None.
+         * @return Pointer to the thread who initiated the timeout.
+         */
+        virtual rtos::thread*
+        waiting_thread (void) override;
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+
         /**
          * @}
          */
@@ -454,26 +814,53 @@ namespace os
       /**
        * @brief Priority ordered list of threads waiting too run.
        */
-      class ready_threads_list : public utils::static_double_list
+      class ready_threads_list
+#if !defined(OS_USE_RTOS_READY_LIST_BITMAP)
+          : public utils::static_double_list
+#endif
       {
       public:
 
+#if defined(OS_USE_RTOS_READY_LIST_BITMAP)
+
         /**
-         * @name Constructors & Destructor
+         * @name Types and constants
          * @{
          */
 
         /**
-         * @brief Construct a list of waiting threads.
+         * @brief Number of priority levels, one for each possible
+         *  `thread::priority_t` value.
          */
-        ready_threads_list ();
+        static constexpr std::size_t levels = 256;
 
         /**
-         * @cond ignore
+         * @brief Number of bits in a bitmap word.
          */
+        static constexpr std::size_t bits_per_word = 32;
 
-        ready_threads_list (const ready_threads_list&) = delete;
-        ready_threads_list (ready_threads_list&&) = delete;
+        /**
+         * @}
+         */
+
+#endif /* defined(OS_USE_RTOS_READY_LIST_BITMAP) */
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a list of waiting threads.
+         */
+        ready_threads_list ();
+
+        /**
+         * @cond ignore
+         */
+
+        ready_threads_list (const ready_threads_list&) = delete;
+        ready_threads_list (ready_threads_list&&) = delete;
         ready_threads_list&
         operator= (const ready_threads_list&) = delete;
         ready_threads_list&
@@ -508,6 +895,20 @@ namespace os
         void
         link (waiting_thread_node& node);
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+
+        /**
+         * @brief Add a new thread node in front of the nodes
+         *  with the same priority.
+         * @param [in] node Reference to a list node.
+         * @par Returns
+         *  Nothing.
+         */
+        void
+        link_head (waiting_thread_node& node);
+
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
         /**
          * @brief Get list head.
          * @par Parameters
@@ -526,11 +927,117 @@ namespace os
         thread*
         unlink_head (void);
 
+        /**
+         * @brief Remove a node from the list.
+         * @param [in] node Reference to a list node.
+         * @par Returns
+         *  Nothing.
+         */
+        void
+        unlink (waiting_thread_node& node);
+
+#if defined(OS_USE_RTOS_READY_LIST_BITMAP)
+
+        /**
+         * @brief Check if the list is empty.
+         * @par Parameters
+         *  None.
+         * @retval true There are no ready threads.
+         * @retval false There is at least one ready thread.
+         */
+        bool
+        empty (void) const;
+
+#endif /* defined(OS_USE_RTOS_READY_LIST_BITMAP) */
+
         // TODO add iterator begin(), end()
 
         /**
          * @}
          */
+
+#if defined(OS_USE_RTOS_READY_LIST_BITMAP)
+
+      protected:
+
+        /**
+         * @name Private Member Functions
+         * @{
+         */
+
+        /**
+         * @cond ignore
+         */
+
+        /**
+         * @brief FIFO list of threads with the same priority.
+         */
+        class priority_list : public utils::static_double_list
+        {
+        public:
+
+          void
+          link_tail (waiting_thread_node& node);
+
+          void
+          link_front (waiting_thread_node& node);
+
+          const utils::static_double_list_links*
+          head_links (void) const;
+        };
+
+        /**
+         * @brief Get the highest priority with ready threads.
+         * @par Parameters
+         *  None.
+         * @return Index of the highest non-empty list.
+         */
+        std::size_t
+        top_level (void) const;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @}
+         */
+
+      protected:
+
+        /**
+         * @name Private Member Variables
+         * @{
+         */
+
+        /**
+         * @cond ignore
+         */
+
+        /**
+         * @brief One FIFO list for each priority level.
+         */
+        priority_list lists_[levels];
+
+        /**
+         * @brief One bit for each non-empty list.
+         */
+        uint32_t map_[levels / bits_per_word];
+
+        /**
+         * @brief One bit for each non-zero word in `map_`.
+         */
+        uint32_t summary_;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @}
+         */
+
+#endif /* defined(OS_USE_RTOS_READY_LIST_BITMAP) */
       };
 
       // ======================================================================
@@ -635,6 +1142,36 @@ namespace os
         void
         resume_all (void);
 
+        /**
+         * @brief Wake-up the threads whose expected event flags
+         *  are raised.
+         * @param [in] flags Reference to the event flags.
+         * @par Returns
+         *  Nothing.
+         *
+         * @details
+         * All nodes in the list must be `waiting_flags_node`.
+         */
+        void
+        resume_raised (event_flags& flags);
+
+        /**
+         * @brief Wake-up, in order, the threads whose requested
+         *  units fit in the available count.
+         * @param [in] count The number of available units.
+         * @par Returns
+         *  Nothing.
+         *
+         * @details
+         * All nodes in the list must be `waiting_request_node`, with
+         * the number of requested units (not zero) in `request_`. The
+         * walk stops at the first thread which requests more than
+         * what is left, or when nothing is left, so its cost is
+         * bounded by the number of resumed threads.
+         */
+        void
+        resume_counted (std::size_t count);
+
         /**
          * @brief Iterator begin.
          * @return An iterator positioned at the first element.
@@ -663,6 +1200,34 @@ namespace os
       {
       public:
 
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+
+        /**
+         * @name Types and constants
+         * @{
+         */
+
+        /**
+         * @brief Number of time stamp bits resolved by each wheel level.
+         */
+        static constexpr std::size_t slot_bits = 6;
+
+        /**
+         * @brief Number of slots in each wheel level.
+         */
+        static constexpr std::size_t slots = (1u << slot_bits);
+
+        /**
+         * @brief Number of wheel levels.
+         */
+        static constexpr std::size_t levels = 4;
+
+        /**
+         * @}
+         */
+
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
+
         /**
          * @name Constructors & Destructor
          * @{
@@ -731,9 +1296,135 @@ namespace os
         void
         check_timestamp (port::clock::timestamp_t now);
 
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+
+        /**
+         * @brief Check if there are no time stamps.
+         * @par Parameters
+         *  None.
+         * @retval true There are no time stamps.
+         * @retval false There is at least one time stamp.
+         */
+        bool
+        empty (void) const;
+
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
+
+        /**
+         * @}
+         */
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) \
+  || defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+      protected:
+
+        /**
+         * @name Private Member Functions
+         * @{
+         */
+
+        /**
+         * @cond ignore
+         */
+
+        /**
+         * @brief Unordered list of time stamp nodes.
+         */
+        class slot_list : public utils::double_list
+        {
+        public:
+
+          void
+          link_tail (timestamp_node& node);
+        };
+
+#endif
+
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+        bool
+        expire_batch_ (port::clock::timestamp_t now);
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+
+        void
+        link_ordered_ (timestamp_node& node);
+
+        void
+        link_wheel_ (timestamp_node& node);
+
+        void
+        advance_ (port::clock::timestamp_t now);
+
+        void
+        order_slots_ (std::size_t level, uint64_t mask);
+
+        void
+        relink_ (slot_list& list);
+
+        void
+        rebase_ (port::clock::timestamp_t now);
+
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) \
+  || defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @}
+         */
+
+#endif
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+
+      protected:
+
+        /**
+         * @name Private Member Variables
+         * @{
+         */
+
+        /**
+         * @cond ignore
+         */
+
+        /**
+         * @brief Time stamps too far away for the wheel.
+         */
+        slot_list overflow_;
+
+        /**
+         * @brief The wheel slots, one array for each level.
+         */
+        slot_list wheel_[levels][slots];
+
+        /**
+         * @brief One bit for each possibly non-empty slot.
+         */
+        uint64_t map_[levels] = { 0 };
+
+        /**
+         * @brief The time stamp of the latest check.
+         */
+        port::clock::timestamp_t base_ = 0;
+
+        /**
+         * @endcond
+         */
+
         /**
          * @}
          */
+
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
       };
 
       // ======================================================================
@@ -812,6 +1503,85 @@ namespace os
 
       };
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+      // ======================================================================
+
+      /**
+       * @brief List of timers waiting for the timer daemon.
+       */
+      class timer_nodes_list : public utils::static_double_list
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a list of timer nodes.
+         */
+        timer_nodes_list ();
+
+        /**
+         * @cond ignore
+         */
+
+        timer_nodes_list (const timer_nodes_list&) = delete;
+        timer_nodes_list (timer_nodes_list&&) = delete;
+        timer_nodes_list&
+        operator= (const timer_nodes_list&) = delete;
+        timer_nodes_list&
+        operator= (timer_nodes_list&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the list.
+         */
+        ~timer_nodes_list ();
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Functions
+         * @{
+         */
+
+        /**
+         * @brief Add a new timer node to the end of the list.
+         * @param [in] node Reference to a list node.
+         * @par Returns
+         *  Nothing.
+         */
+        void
+        link (timer_node& node);
+
+        /**
+         * @brief Get list head.
+         * @par Parameters
+         *  None.
+         * @return Casted pointer to head node.
+         */
+        volatile timer_node*
+        head (void) const;
+
+        /**
+         * @}
+         */
+
+      };
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
     }
     ;
     /* namespace internal */
@@ -862,6 +1632,13 @@ namespace os
 
       // ======================================================================
 
+      inline
+      waiting_thread_node::waiting_thread_node () :
+          thread_ (nullptr)
+      {
+        ;
+      }
+
       inline
       waiting_thread_node::waiting_thread_node (rtos::thread& th) :
           thread_ (&th)
@@ -877,6 +1654,97 @@ namespace os
 
       // ======================================================================
 
+      inline
+      waiting_request_node::waiting_request_node () :
+          request_ (0)
+      {
+        ;
+      }
+
+      inline
+      waiting_request_node::waiting_request_node (rtos::thread& th,
+                                                  std::size_t request) :
+          waiting_thread_node
+            { th }, //
+          request_ (request)
+      {
+        ;
+      }
+
+      inline
+      waiting_request_node::~waiting_request_node ()
+      {
+        ;
+      }
+
+      // ======================================================================
+
+      inline
+      waiting_flags_node::waiting_flags_node () :
+          mask_ (0), //
+          mode_ (0)
+      {
+        ;
+      }
+
+      inline
+      waiting_flags_node::waiting_flags_node (rtos::thread& th,
+                                              flags::mask_t mask,
+                                              flags::mode_t mode) :
+          waiting_request_node
+            { th, 0 }, //
+          mask_ (mask), //
+          mode_ (mode)
+      {
+        ;
+      }
+
+      inline
+      waiting_flags_node::~waiting_flags_node ()
+      {
+        ;
+      }
+
+      // ======================================================================
+
+      inline
+      waiting_message_node::waiting_message_node (rtos::thread& th, void* msg,
+                                                  std::size_t nbytes,
+                                                  uint8_t prio) :
+          waiting_request_node
+            { th, msg != nullptr ? nbytes : 0 }, //
+          msg_ (msg), //
+          prio_ (prio)
+      {
+        ;
+      }
+
+      inline
+      waiting_message_node::~waiting_message_node ()
+      {
+        ;
+      }
+
+      // ======================================================================
+
+      inline
+      waiting_condvar_node::waiting_condvar_node (rtos::thread& th,
+                                                  rtos::mutex& mx) :
+          waiting_thread_node
+            { th }, //
+          mutex_ (&mx)
+      {
+        ;
+      }
+
+      inline
+      waiting_condvar_node::~waiting_condvar_node ()
+      {
+        ;
+      }
+
+      // ======================================================================
+
       /**
        * @details
        * The initial list status is empty.
@@ -911,12 +1779,59 @@ namespace os
         ;
       }
 
+#if !defined(OS_USE_RTOS_READY_LIST_BITMAP)
+
       inline volatile waiting_thread_node*
       ready_threads_list::head (void) const
       {
         return static_cast<volatile waiting_thread_node*> (static_double_list::head ());
       }
 
+      inline void
+      ready_threads_list::unlink (waiting_thread_node& node)
+      {
+        node.unlink ();
+      }
+
+#else
+
+      inline bool
+      ready_threads_list::empty (void) const
+      {
+        return (summary_ == 0);
+      }
+
+      /**
+       * @details
+       * The first word with at least one bit set is identified from
+       * the summary word, then the highest bit in that word, both
+       * with a count-leading-zeros instruction.
+       *
+       * Must not be called when the list is empty.
+       */
+      inline std::size_t
+      ready_threads_list::top_level (void) const
+      {
+        std::size_t word = (bits_per_word - 1)
+            - static_cast<std::size_t> (__builtin_clz (summary_));
+        return (word * bits_per_word) + (bits_per_word - 1)
+            - static_cast<std::size_t> (__builtin_clz (map_[word]));
+      }
+
+      inline volatile waiting_thread_node*
+      ready_threads_list::head (void) const
+      {
+        return static_cast<volatile waiting_thread_node*> (lists_[top_level ()].head ());
+      }
+
+      inline const utils::static_double_list_links*
+      ready_threads_list::priority_list::head_links (void) const
+      {
+        return &head_;
+      }
+
+#endif /* !defined(OS_USE_RTOS_READY_LIST_BITMAP) */
+
       // ======================================================================
 
       /**
@@ -971,12 +1886,16 @@ namespace os
         ;
       }
 
+#if !defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+
       inline volatile timestamp_node*
       clock_timestamps_list::head (void) const
       {
         return static_cast<volatile timestamp_node*> (double_list::head ());
       }
 
+#endif /* !defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
+
       // ======================================================================
 
       /**
@@ -1001,6 +1920,31 @@ namespace os
         return static_cast<volatile waiting_thread_node*> (static_double_list::head ());
       }
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+      // ======================================================================
+
+      inline
+      timer_nodes_list::timer_nodes_list ()
+      {
+        ;
+      }
+
+      inline
+      timer_nodes_list::~timer_nodes_list ()
+      {
+        ;
+      }
+
+      inline volatile timer_node*
+      timer_nodes_list::head (void) const
+      {
+        return static_cast<volatile timer_node*> (static_double_list::head ());
+      }
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
     // ------------------------------------------------------------------------
     } /* namespace internal */
   } /* namespace rtos */
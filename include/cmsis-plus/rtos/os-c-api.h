@@ -1432,6 +1432,95 @@ extern "C"
   os_result_t
   os_mutex_reset (os_mutex_t* mutex);
 
+  /**
+   * @}
+   */
+
+  // --------------------------------------------------------------------------
+  /**
+   * @name Mutex Statistics Functions
+   * @{
+   */
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+  /**
+   * @brief Get the number of times the mutex was acquired.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer; recursive relocks are not counted.
+   */
+  os_statistics_counter_t
+  os_mutex_stat_get_acquisitions (os_mutex_t* mutex);
+
+  /**
+   * @brief Get the number of acquisitions that had to wait.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer with the number of contended acquisitions.
+   */
+  os_statistics_counter_t
+  os_mutex_stat_get_contended_acquisitions (os_mutex_t* mutex);
+
+  /**
+   * @brief Get the total time spent waiting for the mutex.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer with accumulated number of cycles.
+   */
+  os_statistics_duration_t
+  os_mutex_stat_get_wait_cycles (os_mutex_t* mutex);
+
+  /**
+   * @brief Get the longest wait for the mutex.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer with the number of cycles.
+   */
+  os_statistics_duration_t
+  os_mutex_stat_get_max_wait_cycles (os_mutex_t* mutex);
+
+  /**
+   * @brief Get the total time the mutex was held.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer with accumulated number of cycles.
+   */
+  os_statistics_duration_t
+  os_mutex_stat_get_hold_cycles (os_mutex_t* mutex);
+
+  /**
+   * @brief Get the longest time the mutex was held.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer with the number of cycles.
+   */
+  os_statistics_duration_t
+  os_mutex_stat_get_max_hold_cycles (os_mutex_t* mutex);
+
+  /**
+   * @brief Get the number of times priority inheritance boosted the owner.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @return A long integer with the number of boosts.
+   */
+  os_statistics_counter_t
+  os_mutex_stat_get_boosts (os_mutex_t* mutex);
+
+  /**
+   * @brief Clear the mutex statistics.
+   * @param [in] mutex Pointer to mutex object instance.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_mutex_stat_clear (os_mutex_t* mutex);
+
+  /**
+   * @brief Print the statistics of all mutexes.
+   * @par Parameters
+   *  None.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_mutex_stat_trace_print_all (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
   /**
    * @}
    */
@@ -1638,6 +1727,213 @@ extern "C"
 #define os_condvar_create os_condvar_construct
 #define os_condvar_destroy os_condvar_destruct
 
+  /**
+   * @}
+   */
+
+  /**
+   * @}
+   */
+
+  // --------------------------------------------------------------------------
+  /**
+   * @addtogroup cmsis-plus-rtos-c-rwlock
+   * @{
+   */
+
+  /**
+   * @name Read-Write Lock Attributes Functions
+   * @{
+   */
+
+  /**
+   * @brief Initialise the read-write lock attributes.
+   * @param [in] attr Pointer to read-write lock attributes object instance.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_rwlock_attr_init (os_rwlock_attr_t* attr);
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Read-Write Lock Creation Functions
+   * @{
+   */
+
+  /**
+   * @brief Construct a statically allocated read-write lock
+   *  object instance.
+   * @param [in] rwlock Pointer to read-write lock object instance storage.
+   * @param [in] name Pointer to name (may be NULL).
+   * @param [in] attr Pointer to attributes (may be NULL).
+   * @par Errors
+   *  The constructor shall fail if:
+   *  - `EAGAIN` - The system lacked the necessary resources
+   *  (other than memory) to create the read-write lock.
+   *  - `ENOMEM` - Insufficient memory exists to initialise
+   *  the read-write lock.
+   * @par
+   *  The constructor shall not fail with an error code of `EINTR`.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_rwlock_construct (os_rwlock_t* rwlock, const char* name,
+                       const os_rwlock_attr_t* attr);
+
+  /**
+   * @brief Destruct the statically allocated read-write lock
+   *  object instance.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_rwlock_destruct (os_rwlock_t* rwlock);
+
+  /**
+   * @brief Allocate a read-write lock object instance and construct it.
+   * @param [in] name Pointer to name (may be NULL).
+   * @param [in] attr Pointer to attributes (may be NULL).
+   * @par Errors
+   *  The constructor shall fail if:
+   *  - `EAGAIN` - The system lacked the necessary resources
+   *  (other than memory) to create the read-write lock.
+   *  - `ENOMEM` - Insufficient memory exists to initialise
+   *  the read-write lock.
+   * @par
+   *  The constructor shall not fail with an error code of `EINTR`.
+   * @return Pointer to new read-write lock object instance.
+   */
+  os_rwlock_t*
+  os_rwlock_new (const char* name, const os_rwlock_attr_t* attr);
+
+  /**
+   * @brief Destruct the read-write lock object instance and deallocate it.
+   * @param [in] rwlock Pointer to dynamically allocated read-write
+   *  lock object instance.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_rwlock_delete (os_rwlock_t* rwlock);
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Read-Write Lock Functions
+   * @{
+   */
+
+  /**
+   * @brief Get the read-write lock name.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @return Null terminated string.
+   */
+  const char*
+  os_rwlock_get_name (os_rwlock_t* rwlock);
+
+  /**
+   * @brief Lock the read-write lock for reading.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @retval os_ok The read lock was acquired.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EAGAIN The maximum number of read locks has been exceeded.
+   * @retval EDEADLK The current thread already owns the
+   *  read-write lock for writing.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_rwlock_read_lock (os_rwlock_t* rwlock);
+
+  /**
+   * @brief Try to lock the read-write lock for reading.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @retval os_ok The read lock was acquired.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EAGAIN The maximum number of read locks has been exceeded.
+   * @retval EDEADLK The current thread already owns the
+   *  read-write lock for writing.
+   * @retval EWOULDBLOCK The read-write lock is locked for writing,
+   *  or writers are waiting.
+   */
+  os_result_t
+  os_rwlock_try_read_lock (os_rwlock_t* rwlock);
+
+  /**
+   * @brief Timed attempt to lock the read-write lock for reading.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @param [in] timeout Timeout to wait.
+   * @retval os_ok The read lock was acquired.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EAGAIN The maximum number of read locks has been exceeded.
+   * @retval EDEADLK The current thread already owns the
+   *  read-write lock for writing.
+   * @retval ETIMEDOUT The read lock could not be acquired before the
+   *  specified timeout expired.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_rwlock_timed_read_lock (os_rwlock_t* rwlock,
+                             os_clock_duration_t timeout);
+
+  /**
+   * @brief Lock the read-write lock for writing.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @retval os_ok The write lock was acquired.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EDEADLK The current thread already owns the
+   *  read-write lock for writing.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_rwlock_write_lock (os_rwlock_t* rwlock);
+
+  /**
+   * @brief Try to lock the read-write lock for writing.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @retval os_ok The write lock was acquired.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EDEADLK The current thread already owns the
+   *  read-write lock for writing.
+   * @retval EWOULDBLOCK The read-write lock is locked for
+   *  reading or writing.
+   */
+  os_result_t
+  os_rwlock_try_write_lock (os_rwlock_t* rwlock);
+
+  /**
+   * @brief Timed attempt to lock the read-write lock for writing.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @param [in] timeout Timeout to wait.
+   * @retval os_ok The write lock was acquired.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EDEADLK The current thread already owns the
+   *  read-write lock for writing.
+   * @retval ETIMEDOUT The write lock could not be acquired before the
+   *  specified timeout expired.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_rwlock_timed_write_lock (os_rwlock_t* rwlock,
+                              os_clock_duration_t timeout);
+
+  /**
+   * @brief Unlock the read-write lock.
+   * @param [in] rwlock Pointer to read-write lock object instance.
+   * @retval os_ok The lock was released.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+   *  or the read-write lock is not locked.
+   */
+  os_result_t
+  os_rwlock_unlock (os_rwlock_t* rwlock);
+
   /**
    * @}
    */
@@ -1866,6 +2162,63 @@ extern "C"
   os_semaphore_timed_wait (os_semaphore_t* semaphore,
                            os_clock_duration_t timeout);
 
+  /**
+   * @brief Post (unlock) the semaphore several times at once.
+   * @param [in] semaphore Pointer to semaphore object instance.
+   * @param [in] n Number of units to add to the count.
+   * @retval os_ok The semaphore was posted.
+   * @retval EINVAL The number of units is not positive.
+   * @retval EAGAIN The maximum count value would be exceeded;
+   *  the count was not changed.
+   */
+  os_result_t
+  os_semaphore_post_n (os_semaphore_t* semaphore, os_semaphore_count_t n);
+
+  /**
+   * @brief Lock several units of the semaphore, possibly waiting.
+   * @param [in] semaphore Pointer to semaphore object instance.
+   * @param [in] n Number of units to take from the count.
+   * @retval os_ok The calling process successfully
+   *  performed the semaphore lock operation.
+   * @retval EINVAL The number of units is not positive or
+   *  exceeds the maximum count value.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_semaphore_wait_n (os_semaphore_t* semaphore, os_semaphore_count_t n);
+
+  /**
+   * @brief Try to lock several units of the semaphore.
+   * @param [in] semaphore Pointer to semaphore object instance.
+   * @param [in] n Number of units to take from the count.
+   * @retval os_ok The calling process successfully
+   *  performed the semaphore lock operation.
+   * @retval EINVAL The number of units is not positive or
+   *  exceeds the maximum count value.
+   * @retval EWOULDBLOCK The count was lower than the requested units.
+   */
+  os_result_t
+  os_semaphore_try_wait_n (os_semaphore_t* semaphore, os_semaphore_count_t n);
+
+  /**
+   * @brief Timed wait to lock several units of the semaphore.
+   * @param [in] semaphore Pointer to semaphore object instance.
+   * @param [in] n Number of units to take from the count.
+   * @param [in] timeout Timeout to wait.
+   * @retval os_ok The calling process successfully
+   *  performed the semaphore lock operation.
+   * @retval EINVAL The number of units is not positive or
+   *  exceeds the maximum count value.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ETIMEDOUT The semaphore could not be locked before
+   *  the specified timeout expired.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_semaphore_timed_wait_n (os_semaphore_t* semaphore, os_semaphore_count_t n,
+                             os_clock_duration_t timeout);
+
   /**
    * @brief Get the semaphore count value.
    * @param [in] semaphore Pointer to semaphore object instance.
@@ -2351,6 +2704,250 @@ extern "C"
                            os_clock_duration_t timeout,
                            os_mqueue_prio_t* mprio);
 
+  /**
+   * @brief Send an array of messages to the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [in] msgs The address of the array of messages, each
+   *  of the queue message size.
+   * @param [in] nmsgs The number of messages in the array.
+   * @param [out] sent The address where to store the number
+   *  of messages enqueued, or `NULL`.
+   * @param [in] mprio The messages priority. Enter 0 if priorities are not used.
+   * @retval os_ok All messages were enqueued.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_send_many (os_mqueue_t* mqueue, const void* msgs, size_t nmsgs,
+                       size_t* sent, os_mqueue_prio_t mprio);
+
+  /**
+   * @brief Try to send an array of messages to the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [in] msgs The address of the array of messages, each
+   *  of the queue message size.
+   * @param [in] nmsgs The number of messages in the array.
+   * @param [out] sent The address where to store the number
+   *  of messages enqueued, or `NULL`.
+   * @param [in] mprio The messages priority. Enter 0 if priorities are not used.
+   * @retval os_ok At least one message was enqueued.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EWOULDBLOCK The specified message queue is full.
+   */
+  os_result_t
+  os_mqueue_try_send_many (os_mqueue_t* mqueue, const void* msgs,
+                           size_t nmsgs, size_t* sent, os_mqueue_prio_t mprio);
+
+  /**
+   * @brief Send an array of messages to the queue with timeout.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [in] msgs The address of the array of messages, each
+   *  of the queue message size.
+   * @param [in] nmsgs The number of messages in the array.
+   * @param [out] sent The address where to store the number
+   *  of messages enqueued, or `NULL`.
+   * @param [in] timeout The timeout duration.
+   * @param [in] mprio The messages priority. Enter 0 if priorities are not used.
+   * @retval os_ok All messages were enqueued.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval ETIMEDOUT The timeout expired before all messages
+   *  could be added to the queue.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_timed_send_many (os_mqueue_t* mqueue, const void* msgs,
+                             size_t nmsgs, size_t* sent,
+                             os_clock_duration_t timeout,
+                             os_mqueue_prio_t mprio);
+
+  /**
+   * @brief Receive an array of messages from the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msgs The address of the array where to store
+   *  the messages, each of the queue message size.
+   * @param [in] max_msgs The number of messages in the array.
+   * @param [out] received The address where to store the number
+   *  of messages dequeued.
+   * @param [out] mprios The address of the array where to store
+   *  the priorities. Enter `NULL` if priorities are not used.
+   * @retval os_ok At least one message was received.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_receive_many (os_mqueue_t* mqueue, void* msgs, size_t max_msgs,
+                          size_t* received, os_mqueue_prio_t* mprios);
+
+  /**
+   * @brief Try to receive an array of messages from the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msgs The address of the array where to store
+   *  the messages, each of the queue message size.
+   * @param [in] max_msgs The number of messages in the array.
+   * @param [out] received The address where to store the number
+   *  of messages dequeued.
+   * @param [out] mprios The address of the array where to store
+   *  the priorities. Enter `NULL` if priorities are not used.
+   * @retval os_ok At least one message was received.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EWOULDBLOCK The specified message queue is empty.
+   */
+  os_result_t
+  os_mqueue_try_receive_many (os_mqueue_t* mqueue, void* msgs,
+                              size_t max_msgs, size_t* received,
+                              os_mqueue_prio_t* mprios);
+
+  /**
+   * @brief Receive an array of messages from the queue with timeout.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msgs The address of the array where to store
+   *  the messages, each of the queue message size.
+   * @param [in] max_msgs The number of messages in the array.
+   * @param [out] received The address where to store the number
+   *  of messages dequeued.
+   * @param [in] timeout The timeout duration.
+   * @param [out] mprios The address of the array where to store
+   *  the priorities. Enter `NULL` if priorities are not used.
+   * @retval os_ok At least one message was received.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EINTR The operation was interrupted.
+   * @retval ETIMEDOUT No message arrived on the queue before the
+   *  specified timeout expired.
+   */
+  os_result_t
+  os_mqueue_timed_receive_many (os_mqueue_t* mqueue, void* msgs,
+                                size_t max_msgs, size_t* received,
+                                os_clock_duration_t timeout,
+                                os_mqueue_prio_t* mprios);
+
+  /**
+   * @brief Borrow a free message slot from the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msg The address where to store the slot address.
+   * @retval os_ok A slot was loaned.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_loan (os_mqueue_t* mqueue, void** msg);
+
+  /**
+   * @brief Try to borrow a free message slot from the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msg The address where to store the slot address.
+   * @retval os_ok A slot was loaned.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EWOULDBLOCK The specified message queue is full.
+   */
+  os_result_t
+  os_mqueue_try_loan (os_mqueue_t* mqueue, void** msg);
+
+  /**
+   * @brief Borrow a free message slot from the queue with timeout.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msg The address where to store the slot address.
+   * @param [in] timeout The timeout duration.
+   * @retval os_ok A slot was loaned.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval ETIMEDOUT No slot was freed before the
+   *  specified timeout expired.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_timed_loan (os_mqueue_t* mqueue, void** msg,
+                        os_clock_duration_t timeout);
+
+  /**
+   * @brief Enqueue a loaned message slot.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [in] msg The slot address, as returned by `os_mqueue_loan()`.
+   * @param [in] mprio The message priority. Enter 0 if priorities are not used.
+   * @retval os_ok The message was enqueued.
+   * @retval EINVAL The address is not a slot of this queue,
+   *  or the slot is not loaned.
+   * @retval ENOTSUP The queue is implemented by the port.
+   */
+  os_result_t
+  os_mqueue_commit (os_mqueue_t* mqueue, void* msg, os_mqueue_prio_t mprio);
+
+  /**
+   * @brief Dequeue a message, without copying it.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msg The address where to store the slot address.
+   * @param [out] mprio The address where to store the message
+   *  priority. Enter `NULL` if priorities are not used.
+   * @retval os_ok A message was dequeued.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_acquire (os_mqueue_t* mqueue, void** msg, os_mqueue_prio_t* mprio);
+
+  /**
+   * @brief Try to dequeue a message, without copying it.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msg The address where to store the slot address.
+   * @param [out] mprio The address where to store the message
+   *  priority. Enter `NULL` if priorities are not used.
+   * @retval os_ok A message was dequeued.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval EWOULDBLOCK The specified message queue is empty.
+   */
+  os_result_t
+  os_mqueue_try_acquire (os_mqueue_t* mqueue, void** msg,
+                         os_mqueue_prio_t* mprio);
+
+  /**
+   * @brief Dequeue a message with timeout, without copying it.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [out] msg The address where to store the slot address.
+   * @param [in] timeout The timeout duration.
+   * @param [out] mprio The address where to store the message
+   *  priority. Enter `NULL` if priorities are not used.
+   * @retval os_ok A message was dequeued.
+   * @retval EINVAL A parameter is invalid or outside of a permitted range.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ENOTSUP The queue is implemented by the port.
+   * @retval ETIMEDOUT No message arrived on the queue before the
+   *  specified timeout expired.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mqueue_timed_acquire (os_mqueue_t* mqueue, void** msg,
+                           os_clock_duration_t timeout,
+                           os_mqueue_prio_t* mprio);
+
+  /**
+   * @brief Return a message slot to the queue.
+   * @param [in] mqueue Pointer to message queue object instance.
+   * @param [in] msg The slot address, as returned by
+   *  `os_mqueue_acquire()` or by `os_mqueue_loan()`.
+   * @retval os_ok The slot is free again.
+   * @retval EINVAL The address is not a slot of this queue,
+   *  or the slot is neither loaned nor acquired.
+   * @retval ENOTSUP The queue is implemented by the port.
+   */
+  os_result_t
+  os_mqueue_release (os_mqueue_t* mqueue, void* msg);
+
   /**
    * @brief Get queue capacity.
    * @param [in] mqueue Pointer to message queue object instance.
@@ -2414,6 +3011,184 @@ extern "C"
 #define os_mqueue_create os_mqueue_construct
 #define os_mqueue_destroy os_mqueue_destruct
 
+  /**
+   * @}
+   */
+
+  /**
+   * @}
+   */
+
+  // --------------------------------------------------------------------------
+  /**
+   * @addtogroup cmsis-plus-rtos-c-mpmcqueue
+   * @{
+   */
+
+  /**
+   * @name Lock Free Queue Creation Functions
+   * @{
+   */
+
+  /**
+   * @brief Calculate the queue storage size.
+   * @param [in] capacity Number of elements, a power of 2.
+   * @param [in] elem_size_bytes Size of an element, in bytes.
+   * @return The storage size, in bytes.
+   */
+  size_t
+  os_mpmc_queue_compute_storage_size (size_t capacity, size_t elem_size_bytes);
+
+  /**
+   * @brief Construct a statically allocated lock free queue
+   *  object instance.
+   * @param [in] queue Pointer to queue object instance storage.
+   * @param [in] name Pointer to name (may be NULL).
+   * @param [in] capacity Number of elements, a power of 2.
+   * @param [in] elem_size_bytes Size of an element, in bytes.
+   * @param [in] storage Pointer to the cells storage.
+   * @param [in] storage_size_bytes Size of the cells storage, in bytes.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_mpmc_queue_construct (os_mpmc_queue_t* queue, const char* name,
+                           size_t capacity, size_t elem_size_bytes,
+                           void* storage, size_t storage_size_bytes);
+
+  /**
+   * @brief Destruct the statically allocated lock free queue
+   *  object instance.
+   * @param [in] queue Pointer to queue object instance.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_mpmc_queue_destruct (os_mpmc_queue_t* queue);
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Lock Free Queue Functions
+   * @{
+   */
+
+  /**
+   * @brief Get the queue name.
+   * @param [in] queue Pointer to queue object instance.
+   * @return Null terminated string.
+   */
+  const char*
+  os_mpmc_queue_get_name (os_mpmc_queue_t* queue);
+
+  /**
+   * @brief Add an element to the queue, without blocking.
+   * @param [in] queue Pointer to queue object instance.
+   * @param [in] elem Pointer to the element to copy.
+   * @retval os_ok The element was added to the queue.
+   * @retval EWOULDBLOCK The queue was full.
+   */
+  os_result_t
+  os_mpmc_queue_try_push (os_mpmc_queue_t* queue, const void* elem);
+
+  /**
+   * @brief Add an element to the queue, waiting if the queue is full.
+   * @param [in] queue Pointer to queue object instance.
+   * @param [in] elem Pointer to the element to copy.
+   * @retval os_ok The element was added to the queue.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mpmc_queue_push (os_mpmc_queue_t* queue, const void* elem);
+
+  /**
+   * @brief Add an element to the queue, waiting if the queue is
+   *  full, with timeout.
+   * @param [in] queue Pointer to queue object instance.
+   * @param [in] elem Pointer to the element to copy.
+   * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+   * @retval os_ok The element was added to the queue.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ETIMEDOUT The queue remained full until the timeout.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mpmc_queue_timed_push (os_mpmc_queue_t* queue, const void* elem,
+                            os_clock_duration_t timeout);
+
+  /**
+   * @brief Remove the oldest element, without blocking.
+   * @param [in] queue Pointer to queue object instance.
+   * @param [out] elem Pointer where to copy the element.
+   * @retval os_ok The element was removed from the queue.
+   * @retval EWOULDBLOCK The queue was empty.
+   */
+  os_result_t
+  os_mpmc_queue_try_pop (os_mpmc_queue_t* queue, void* elem);
+
+  /**
+   * @brief Remove the oldest element, waiting if the queue is empty.
+   * @param [in] queue Pointer to queue object instance.
+   * @param [out] elem Pointer where to copy the element.
+   * @retval os_ok The element was removed from the queue.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mpmc_queue_pop (os_mpmc_queue_t* queue, void* elem);
+
+  /**
+   * @brief Remove the oldest element, waiting if the queue is
+   *  empty, with timeout.
+   * @param [in] queue Pointer to queue object instance.
+   * @param [out] elem Pointer where to copy the element.
+   * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+   * @retval os_ok The element was removed from the queue.
+   * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+   * @retval ETIMEDOUT No element arrived before the timeout.
+   * @retval EINTR The operation was interrupted.
+   */
+  os_result_t
+  os_mpmc_queue_timed_pop (os_mpmc_queue_t* queue, void* elem,
+                           os_clock_duration_t timeout);
+
+  /**
+   * @brief Get the number of elements in the queue.
+   * @param [in] queue Pointer to queue object instance.
+   * @return The number of elements.
+   */
+  size_t
+  os_mpmc_queue_get_length (os_mpmc_queue_t* queue);
+
+  /**
+   * @brief Get the queue capacity.
+   * @param [in] queue Pointer to queue object instance.
+   * @return The maximum number of elements.
+   */
+  size_t
+  os_mpmc_queue_get_capacity (os_mpmc_queue_t* queue);
+
+  /**
+   * @brief Check if the queue is empty.
+   * @param [in] queue Pointer to queue object instance.
+   * @retval true The queue has no elements.
+   * @retval false The queue has some elements.
+   */
+  bool
+  os_mpmc_queue_is_empty (os_mpmc_queue_t* queue);
+
+  /**
+   * @brief Check if the queue is full.
+   * @param [in] queue Pointer to queue object instance.
+   * @retval true The queue is full.
+   * @retval false The queue is not full.
+   */
+  bool
+  os_mpmc_queue_is_full (os_mpmc_queue_t* queue);
+
   /**
    * @}
    */
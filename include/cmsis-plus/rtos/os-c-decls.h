@@ -91,6 +91,12 @@ extern "C"
   typedef struct os_internal_clock_timestamps_list_s
   {
     os_internal_double_list_links_t links;
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+    os_internal_double_list_links_t overflow;
+    os_internal_double_list_links_t wheel[4][64];
+    uint64_t map[4];
+    uint64_t base;
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
   } os_internal_clock_timestamps_list_t;
 
   /**
@@ -545,6 +551,16 @@ extern "C"
      */
     os_thread_prio_t th_priority;
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+    /**
+     * @brief Thread time slice, in system clock ticks.
+     *
+     * @details
+     * If 0, the thread is not subject to time slicing.
+     */
+    os_clock_duration_t th_quantum_ticks;
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
   } os_thread_attr_t;
 
   /**
@@ -580,9 +596,11 @@ extern "C"
     os_internal_double_list_links_t child_links;
     os_internal_thread_children_list_t children;
     os_internal_double_list_links_t mutexes;
+    os_internal_double_list_links_t rwlocks;
     void* joiner;
     void* waiting_node;
     void* clock_node;
+    void* waiting_set;
     void* clock;
     void* allocator;
     void* allocted_stack_address;
@@ -602,6 +620,11 @@ extern "C"
     os_thread_statistics_t statistics;
 #endif /* defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CONTEXT_SWITCHES) */
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+    os_clock_duration_t quantum_ticks;
+    os_clock_duration_t quantum_left;
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
 #if defined(OS_USE_RTOS_PORT_SCHEDULER)
     os_thread_port_data_t port;
 #endif
@@ -651,6 +674,9 @@ extern "C"
     os_internal_clock_timestamps_list_t steady_list;
     os_clock_duration_t sleep_count;
     os_clock_timestamp_t steady_count;
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+    uint32_t seq;
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
 
     /**
      * @endcond
@@ -755,6 +781,20 @@ extern "C"
      */
     os_timer_type_t tm_type;
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+    /**
+     * @brief Run the timer function in the clock interrupt.
+     */
+    bool tm_in_isr;
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+    /**
+     * @brief Timer tolerance, in clock units.
+     */
+    os_clock_duration_t tm_slack;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
+
   } os_timer_attr_t;
 
   /**
@@ -786,12 +826,20 @@ extern "C"
     void* clock;
     os_internal_clock_timer_node_t clock_node;
     os_clock_duration_t period;
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+    os_clock_timestamp_t nominal;
+    os_clock_duration_t slack;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
 #endif
 #if defined(OS_USE_RTOS_PORT_TIMER)
     os_timer_port_data_t port_;
 #endif
     os_timer_type_t type;
     os_timer_state_t state;
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+    bool in_isr;
+    bool pending;
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
 
     /**
      * @endcond
@@ -942,6 +990,41 @@ extern "C"
 
   } os_mutex_attr_t;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+  /**
+   * @brief Mutex statistics.
+   * @headerfile os-c-api.h <cmsis-plus/rtos/os-c-api.h>
+   *
+   * @details
+   * The members of this structure are hidden and should not
+   * be accessed directly, but through associated functions.
+   *
+   * @see os::rtos::mutex::statistics
+   */
+  typedef struct os_mutex_statistics_s
+  {
+    /**
+     * @cond ignore
+     */
+
+    os_statistics_counter_t acquisitions;
+    os_statistics_counter_t contended_acquisitions;
+    os_statistics_duration_t wait_cycles;
+    os_statistics_duration_t max_wait_cycles;
+    os_statistics_duration_t hold_cycles;
+    os_statistics_duration_t max_hold_cycles;
+    os_statistics_counter_t boosts;
+    os_clock_timestamp_t lock_timestamp;
+
+    /**
+     * @endcond
+     */
+
+  } os_mutex_statistics_t;
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
   /**
    * @brief Mutex object storage.
    * @headerfile os-c-api.h <cmsis-plus/rtos/os-c-api.h>
@@ -971,6 +1054,9 @@ extern "C"
     void* clock;
 #endif
     os_internal_double_list_links_t owner_links;
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+    os_internal_double_list_links_t statistics_links;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
 #if defined(OS_USE_RTOS_PORT_MUTEX)
     os_mutex_port_data_t port;
 #endif
@@ -985,6 +1071,9 @@ extern "C"
     os_mutex_protocol_t protocol;
     os_mutex_robustness_t robustness;
     os_mutex_count_t max_count;
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+    os_mutex_statistics_t statistics;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
 
     /**
      * @endcond
@@ -1058,6 +1147,90 @@ extern "C"
 
   } os_condvar_t;
 
+  /**
+   * @}
+   */
+
+  // ==========================================================================
+  /**
+   * @addtogroup cmsis-plus-rtos-c-rwlock
+   * @{
+   */
+
+  /**
+   * @brief Type of variables holding read-write lock counters.
+   */
+  typedef uint16_t os_rwlock_count_t;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpadded"
+
+  /**
+   * @brief Read-write lock attributes.
+   * @headerfile os-c-api.h <cmsis-plus/rtos/os-c-api.h>
+   *
+   * @details
+   * Initialise this structure with `os_rwlock_attr_init()` and then
+   * set any of the individual members directly.
+   *
+   * @see os::rtos::rwlock::attributes
+   */
+  typedef struct os_rwlock_attr_s
+  {
+    /**
+     * @brief Pointer to clock object instance.
+     */
+    void* clock;
+
+    /**
+     * @brief Maximum number of concurrent readers.
+     */
+    os_rwlock_count_t rw_max_readers;
+
+  } os_rwlock_attr_t;
+
+  /**
+   * @brief Read-write lock object storage.
+   * @headerfile os-c-api.h <cmsis-plus/rtos/os-c-api.h>
+   *
+   * @details
+   * This C structure has the same size as the C++
+   * @ref os::rtos::rwlock
+   * object and must be initialised with os_rwlock_construct().
+   *
+   * Later on a pointer to it can be used both in C and C++
+   * to refer to the read-write lock object instance.
+   *
+   * The members of this structure are hidden and should not
+   * be used directly, but only through specific functions.
+   *
+   * @see os::rtos::rwlock
+   */
+  typedef struct os_rwlock_s
+  {
+    /**
+     * @cond ignore
+     */
+
+    const char* name;
+    void* writer;
+    os_internal_threads_waiting_list_t readers_list;
+    os_internal_threads_waiting_list_t writers_list;
+    void* clock;
+    os_rwlock_count_t readers;
+    os_rwlock_count_t writers_waiting;
+    os_internal_double_list_links_t owner_links;
+    os_thread_prio_t boosted_prio;
+    os_rwlock_count_t max_readers;
+
+    /**
+     * @endcond
+     */
+
+  } os_rwlock_t;
+
+#pragma GCC diagnostic pop
+
   /**
    * @}
    */
@@ -1132,6 +1305,7 @@ extern "C"
     const char* name;
 #if !defined(OS_USE_RTOS_PORT_SEMAPHORE)
     os_internal_threads_waiting_list_t list;
+    os_internal_threads_waiting_list_t sets_list;
     void* clock;
 #endif
 #if defined(OS_USE_RTOS_PORT_SEMAPHORE)
@@ -1219,6 +1393,7 @@ extern "C"
     const char* name;
 #if !defined(OS_USE_RTOS_PORT_MEMORY_POOL)
     os_internal_threads_waiting_list_t list;
+    os_internal_threads_waiting_list_t sets_list;
     void* clock;
 #endif
     void* pool_addr;
@@ -1327,10 +1502,12 @@ extern "C"
 #if !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
     os_internal_threads_waiting_list_t send_list;
     os_internal_threads_waiting_list_t receive_list;
+    os_internal_threads_waiting_list_t sets_list;
     void* clock;
     os_mqueue_index_t* prev_array;
     os_mqueue_index_t* next_array;
     os_mqueue_prio_t* prio_array;
+    uint8_t* state_array;
     void* first_free;
 #endif
 
@@ -1351,6 +1528,11 @@ extern "C"
     os_mqueue_size_t count;
 #if !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
     os_mqueue_index_t head;
+#if defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP)
+    os_mqueue_index_t tails[0xFF + 1];
+    uint32_t prio_map[(0xFF + 1) / 32];
+    uint32_t prio_summary;
+#endif
 #endif
 
     /**
@@ -1361,6 +1543,55 @@ extern "C"
 
 #pragma GCC diagnostic pop
 
+  /**
+   * @}
+   */
+
+  // ==========================================================================
+  /**
+   * @addtogroup cmsis-plus-rtos-c-mpmcqueue
+   * @{
+   */
+
+  /**
+   * @brief Lock free queue object storage.
+   * @headerfile os-c-api.h <cmsis-plus/rtos/os-c-api.h>
+   *
+   * @details
+   * This C structure has the same size as the C++
+   * @ref os::rtos::mpmc_queue_base
+   * object and must be initialised with os_mpmc_queue_construct().
+   *
+   * Later on a pointer to it can be used both in C and C++
+   * to refer to the queue object instance.
+   *
+   * The members of this structure are hidden and should not
+   * be used directly, but only through specific functions.
+   *
+   * @see os::rtos::mpmc_queue_base
+   */
+  typedef struct os_mpmc_queue_s
+  {
+    /**
+     * @cond ignore
+     */
+
+    const char* name;
+    size_t enqueue_pos;
+    size_t dequeue_pos;
+    void* storage;
+    size_t mask;
+    size_t elem_size_bytes;
+    size_t cell_size_bytes;
+    os_internal_threads_waiting_list_t consumers_list;
+    os_internal_threads_waiting_list_t producers_list;
+
+    /**
+     * @endcond
+     */
+
+  } os_mpmc_queue_t;
+
   /**
    * @}
    */
@@ -218,6 +218,48 @@ namespace os
       result_t
       wait_for (duration_t timeout);
 
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+
+      /**
+       * @brief Sleep for a relative duration, with tolerance.
+       * @param [in] duration The number of clock units
+       *  (ticks or seconds) to sleep.
+       * @param [in] slack The number of clock units the wake-up
+       *  may be delayed, to be grouped with other deadlines.
+       * @retval ETIMEDOUT The sleep lasted the entire duration.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EINTR The sleep was interrupted.
+       */
+      result_t
+      sleep_for (duration_t duration, duration_t slack);
+
+      /**
+       * @brief Timed wait for an event, with tolerance.
+       * @param [in] timeout The timeout in clock units.
+       * @param [in] slack The number of clock units the timeout
+       *  may be delayed, to be grouped with other deadlines.
+       * @retval result::ok An event occurred before the timeout.
+       * @retval ETIMEDOUT The wait lasted the entire duration.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EINTR The sleep was interrupted.
+       */
+      result_t
+      wait_for (duration_t timeout, duration_t slack);
+
+      /**
+       * @brief Move a deadline within its tolerance window.
+       * @param [in] timestamp The earliest deadline.
+       * @param [in] slack The number of clock units the deadline
+       *  may be delayed.
+       * @return A time stamp in the [timestamp, timestamp + slack]
+       *  window, aligned to the largest power of two not above
+       *  slack + 1.
+       */
+      static timestamp_t
+      coalesce (timestamp_t timestamp, duration_t slack);
+
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
+
       /**
        * @brief Increase the internal count after a deep sleep.
        * @param duration Number of ticks lost during sleep.
@@ -281,6 +323,61 @@ namespace os
       internal_wait_until_ (timestamp_t timestamp,
                             internal::clock_timestamps_list& list);
 
+      /**
+       * @brief Sleep until a steady time stamp, or until interrupted.
+       * @param timestamp The absolute moment in time, in steady clock units.
+       * @retval ETIMEDOUT The sleep lasted the entire duration.
+       * @retval EINTR The sleep was interrupted.
+       */
+      result_t
+      internal_steady_sleep_until_ (timestamp_t timestamp);
+
+      /**
+       * @brief Wait once until a steady time stamp, or until resumed.
+       * @param timestamp The absolute moment in time, in steady clock units.
+       * @retval result::ok The thread was resumed before the time stamp.
+       * @retval ETIMEDOUT The wait lasted the entire duration.
+       * @retval EINTR The wait was interrupted.
+       */
+      result_t
+      internal_steady_wait_until_ (timestamp_t timestamp);
+
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+      /**
+       * @brief Mark the beginning of a count update.
+       * @details
+       * Must be called in a critical section.
+       */
+      void
+      internal_seq_write_begin_ (void);
+
+      /**
+       * @brief Mark the end of a count update.
+       * @details
+       * Must be called in a critical section.
+       */
+      void
+      internal_seq_write_end_ (void);
+
+      /**
+       * @brief Start reading the count.
+       * @return The sequence, to be checked after reading.
+       */
+      uint32_t
+      internal_seq_read_begin_ (void) const;
+
+      /**
+       * @brief Check if the count must be read again.
+       * @param seq The sequence returned by `internal_seq_read_begin_()`.
+       * @retval true The count was updated while being read.
+       * @retval false The values read are consistent.
+       */
+      bool
+      internal_seq_read_retry_ (uint32_t seq) const;
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
+
       /**
        * @endcond
        */
@@ -303,6 +400,13 @@ namespace os
        */
       timestamp_t volatile steady_count_ = 0;
 
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      /**
+       * @brief Sequence counter, odd while the count is updated.
+       */
+      uint32_t volatile seq_ = 0;
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
+
       /**
        * @endcond
        */
@@ -533,6 +637,21 @@ namespace os
         static constexpr clock::duration_t
         ticks_cast (Rep_T microsec);
 
+#if defined(OS_INCLUDE_RTOS_TICKLESS_IDLE)
+
+      /**
+       * @cond ignore
+       */
+
+      void
+      internal_tickless_sleep (void);
+
+      /**
+       * @endcond
+       */
+
+#endif /* defined(OS_INCLUDE_RTOS_TICKLESS_IDLE) */
+
       /**
        * @}
        */
@@ -565,6 +684,19 @@ namespace os
 
 #endif /* defined(OS_USE_RTOS_PORT_CLOCK_SYSTICK_WAIT_FOR) */
 
+#if defined(OS_INCLUDE_RTOS_TICKLESS_IDLE)
+
+      /**
+       * @brief Compute the number of ticks that can be suppressed.
+       * @par Parameters
+       *  None.
+       * @return The number of ticks up to the earliest clock deadline.
+       */
+      duration_t
+      internal_ticks_to_deadline_ (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_TICKLESS_IDLE) */
+
       /**
        * @endcond
        */
@@ -828,8 +960,14 @@ namespace os
     __attribute__((always_inline))
     clock::internal_increment_count (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_begin_ ();
+#endif
       // Increment the systick count by 1.
       ++steady_count_;
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_end_ ();
+#endif
     }
 
     inline void
@@ -839,10 +977,74 @@ namespace os
       steady_list_.check_timestamp (steady_count_);
     }
 
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+    // Writers are always in critical sections and readers run at
+    // lower or equal priorities, so on single core devices the
+    // volatile accesses are enough to order the sequence updates.
+
+    inline void
+    __attribute__((always_inline))
+    clock::internal_seq_write_begin_ (void)
+    {
+      ++seq_;
+    }
+
+    inline void
+    __attribute__((always_inline))
+    clock::internal_seq_write_end_ (void)
+    {
+      ++seq_;
+    }
+
+    inline uint32_t
+    __attribute__((always_inline))
+    clock::internal_seq_read_begin_ (void) const
+    {
+      return seq_;
+    }
+
+    inline bool
+    __attribute__((always_inline))
+    clock::internal_seq_read_retry_ (uint32_t seq) const
+    {
+      return ((seq & 1) != 0) || (seq != seq_);
+    }
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
+
     /**
      * @endcond
      */
 
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+
+    /**
+     * @details
+     * Deadlines with similar tolerances are moved to the same
+     * aligned time stamps, so the clock list fires them together,
+     * with a single wake-up.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline clock::timestamp_t
+    clock::coalesce (timestamp_t timestamp, duration_t slack)
+    {
+      if (slack == 0)
+        {
+          return timestamp;
+        }
+
+      // The largest power of two not above slack + 1.
+      uint64_t span = static_cast<uint64_t> (slack) + 1;
+      timestamp_t granule = static_cast<timestamp_t> (1)
+          << (63 - __builtin_clzll (span));
+
+      return (timestamp + slack) & ~(granule - 1);
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
+
     // ========================================================================
     /**
      * @cond ignore
@@ -901,8 +1103,14 @@ namespace os
     __attribute__((always_inline))
     clock_highres::internal_increment_count (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_begin_ ();
+#endif
       // Increment the highres count by SysTick divisor.
       steady_count_ += port::clock_highres::cycles_per_tick ();
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_end_ ();
+#endif
     }
 
     inline uint32_t
@@ -274,6 +274,34 @@ namespace os
        * @}
        */
 
+    protected:
+
+      /**
+       * @name Private Member Functions
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      /**
+       * @brief Wake-up one or all waiting threads.
+       * @param [in] all If true, wake-up all threads.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      internal_wake_ (bool all);
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @}
+       */
+
     protected:
 
       /**
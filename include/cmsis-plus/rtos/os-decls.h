@@ -83,9 +83,11 @@ namespace os
     class memory_pool;
     class message_queue;
     class mutex;
+    class rwlock;
     class semaphore;
     class thread;
     class timer;
+    class wait_set;
 
     // ------------------------------------------------------------------------
 
@@ -1165,6 +1167,38 @@ extern "C"
 #define OS_BOOL_RTOS_SCHEDULER_PREEMPTIVE                   (true)
 #endif
 
+#if !defined(OS_INTEGER_RTOS_THREAD_QUANTUM_TICKS)
+#define OS_INTEGER_RTOS_THREAD_QUANTUM_TICKS                (10)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS)
+#define OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS             (2)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_EVTRACE_RECORDS)
+#define OS_INTEGER_RTOS_EVTRACE_RECORDS                     (256)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_WAIT_SET_MAX_OBJECTS)
+#define OS_INTEGER_RTOS_WAIT_SET_MAX_OBJECTS                (8)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES)
+#define OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES (64)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_CACHE_LINE_SIZE_BYTES)
+#define OS_INTEGER_RTOS_CACHE_LINE_SIZE_BYTES               (32)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_TIMER_DAEMON_STACK_SIZE_BYTES)
+#define OS_INTEGER_RTOS_TIMER_DAEMON_STACK_SIZE_BYTES       (os::rtos::port::stack::default_size_bytes)
+#endif
+
+#if !defined(OS_INTEGER_RTOS_TIMER_DAEMON_PRIORITY)
+#define OS_INTEGER_RTOS_TIMER_DAEMON_PRIORITY               (os::rtos::thread::priority::high)
+#endif
+
 // ----------------------------------------------------------------------------
 
 #endif /* CMSIS_PLUS_RTOS_OS_DECLS_H_ */
@@ -302,6 +302,8 @@ namespace os
        * @cond ignore
        */
 
+      friend class wait_set;
+
 #if !defined(OS_USE_RTOS_PORT_EVENT_FLAGS)
       internal::waiting_threads_list list_;
       clock* clock_;
@@ -0,0 +1,339 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CMSIS_PLUS_RTOS_OS_EVTRACE_H_
+#define CMSIS_PLUS_RTOS_OS_EVTRACE_H_
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+
+#include <cmsis-plus/rtos/os-decls.h>
+#include <cmsis-plus/rtos/os-sched.h>
+#include <cmsis-plus/rtos/os-clocks.h>
+
+#include <cstdio>
+
+// ----------------------------------------------------------------------------
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+
+namespace os
+{
+  namespace rtos
+  {
+    /**
+     * @brief Binary scheduler events trace.
+     * @ingroup cmsis-plus-rtos
+     * @details
+     * Fixed size records are stored in a RAM ring buffer, overwriting
+     * the oldest ones. The buffer can be dumped with a debugger
+     * (for example `dump binary value trace.bin os::rtos::evtrace::ring_`)
+     * and converted to a timeline with `scripts/evtrace-decode.py`.
+     *
+     * Recording does not mask interrupts; the slots are reserved
+     * with an atomic increment.
+     */
+    namespace evtrace
+    {
+      /**
+       * @brief Type of event identifiers.
+       */
+      using event_t = uint32_t;
+
+      /**
+       * @brief Event identifiers.
+       * @details
+       * Warning: must match the decoder.
+       */
+      struct event
+      {
+        enum
+          : event_t
+            {
+              /**
+               * @brief Context switch; object is the previous thread.
+               */
+              thread_switch = 1,
+
+              /**
+               * @brief Thread made ready; object is the resumed thread.
+               */
+              thread_resume = 2,
+
+              /**
+               * @brief Thread linked to a waiting list; object is the list.
+               */
+              wait_begin = 3,
+
+              /**
+               * @brief Thread unlinked from a waiting list.
+               */
+              wait_end = 4,
+
+              /**
+               * @brief Clock tick; object is the clock.
+               */
+              clock_tick = 5,
+
+              /**
+               * @brief Interrupt handler entry; object is the IRQ number.
+               */
+              isr_enter = 6,
+
+              /**
+               * @brief Interrupt handler exit; object is the IRQ number.
+               */
+              isr_exit = 7,
+
+              /**
+               * @brief Timer expired; object is the timer.
+               */
+              timer_expire = 8,
+
+              /**
+               * @brief First value available for application events.
+               */
+              user = 128
+        };
+      };
+
+      /**
+       * @brief Trace record.
+       */
+      struct record
+      {
+        /**
+         * @brief Low 32 bits of the high resolution clock.
+         */
+        uint32_t timestamp;
+
+        /**
+         * @brief Event identifier.
+         */
+        event_t event;
+
+        /**
+         * @brief Address of the running thread.
+         */
+        uint32_t thread;
+
+        /**
+         * @brief Address of the object, or event specific value.
+         */
+        uint32_t object;
+      };
+
+      /**
+       * @brief Magic value at the beginning of the ring.
+       */
+      constexpr uint32_t magic = 0x52544f45; // "EOTR" in memory.
+
+      /**
+       * @brief Ring layout version.
+       */
+      constexpr uint16_t version = 1;
+
+      /**
+       * @brief Trace ring, with a header describing the layout.
+       * @details
+       * Warning: must match the decoder.
+       */
+      struct ring
+      {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t record_size;
+        uint32_t records_count;
+        uint32_t clock_frequency_hz;
+
+        /**
+         * @brief Total number of records written; the next slot
+         * is `head % records_count`.
+         */
+        uint32_t volatile head;
+        uint32_t reserved;
+
+        record records[OS_INTEGER_RTOS_EVTRACE_RECORDS];
+      };
+
+      // The ring keeps its order when the 32-bit head wraps
+      // only if the number of records divides 2^32.
+      static_assert((OS_INTEGER_RTOS_EVTRACE_RECORDS & (OS_INTEGER_RTOS_EVTRACE_RECORDS - 1)) == 0,
+          "OS_INTEGER_RTOS_EVTRACE_RECORDS must be a power of two");
+
+      /**
+       * @cond ignore
+       */
+
+      extern ring ring_;
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @brief Initialise the ring header and discard all records.
+       * @par Parameters
+       *  None.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      initialize (void);
+
+      /**
+       * @brief Record an event.
+       * @param [in] ev Event identifier.
+       * @param [in] object Object address or event specific value.
+       * @par Returns
+       *  Nothing.
+       *
+       * @note Can be invoked from Interrupt Service Routines.
+       */
+      void
+      record_event (event_t ev, uint32_t object);
+
+      /**
+       * @brief Record an event about an object.
+       * @param [in] ev Event identifier.
+       * @param [in] object Pointer to the object.
+       * @par Returns
+       *  Nothing.
+       *
+       * @note Can be invoked from Interrupt Service Routines.
+       */
+      void
+      record_event (event_t ev, const volatile void* object);
+
+      /**
+       * @brief Record an interrupt handler entry.
+       * @param [in] irq Interrupt number.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      isr_enter (uint32_t irq);
+
+      /**
+       * @brief Record an interrupt handler exit.
+       * @param [in] irq Interrupt number.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      isr_exit (uint32_t irq);
+
+      /**
+       * @brief Write the recorded events as a Chrome Trace Event
+       *  JSON timeline.
+       * @param [in] file Output stream.
+       * @retval result::ok The timeline was written.
+       * @retval EIO Writing failed.
+       *
+       * @warning Cannot be invoked from Interrupt Service Routines.
+       */
+      result_t
+      write_json (std::FILE* file);
+
+    } /* namespace evtrace */
+  } /* namespace rtos */
+} /* namespace os */
+
+// ===== Inline & template implementations ====================================
+
+namespace os
+{
+  namespace rtos
+  {
+    namespace evtrace
+    {
+      /**
+       * @details
+       * The slot is reserved in a short interrupts critical section,
+       * so nested interrupts get different slots, on any architecture
+       * (an atomic increment would need LDREX/STREX, not available
+       * on ARMv6-M). A record interrupted before taking the timestamp
+       * may end up later than the records of the interrupt; the
+       * exporters keep the ring order and allow such small steps
+       * back in time.
+       */
+      inline void
+      __attribute__((always_inline))
+      record_event (event_t ev, uint32_t object)
+      {
+        uint32_t index;
+          {
+            // ----- Enter critical section -----------------------------------
+            interrupts::critical_section ics;
+
+            index = ring_.head++ % OS_INTEGER_RTOS_EVTRACE_RECORDS;
+            // ----- Exit critical section ------------------------------------
+          }
+
+        record& r = ring_.records[index];
+        r.timestamp = static_cast<uint32_t> (hrclock.now ());
+        r.event = ev;
+        r.thread =
+            static_cast<uint32_t> (reinterpret_cast<uintptr_t> (scheduler::current_thread_));
+        r.object = object;
+      }
+
+      inline void
+      __attribute__((always_inline))
+      record_event (event_t ev, const volatile void* object)
+      {
+        record_event (
+            ev,
+            static_cast<uint32_t> (reinterpret_cast<uintptr_t> (object)));
+      }
+
+      inline void
+      __attribute__((always_inline))
+      isr_enter (uint32_t irq)
+      {
+        record_event (event::isr_enter, irq);
+      }
+
+      inline void
+      __attribute__((always_inline))
+      isr_exit (uint32_t irq)
+      {
+        record_event (event::isr_exit, irq);
+      }
+
+    } /* namespace evtrace */
+  } /* namespace rtos */
+} /* namespace os */
+
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
+// ----------------------------------------------------------------------------
+
+#endif /* __cplusplus */
+
+#endif /* CMSIS_PLUS_RTOS_OS_EVTRACE_H_ */
@@ -30,6 +30,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // ----------------------------------------------------------------------------
 
@@ -107,6 +108,20 @@ extern "C"
   void
   os_startup_create_thread_idle (void);
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) || defined(__DOXYGEN__)
+
+  /**
+   * @brief Create the timer daemon thread.
+   * @par Parameters
+   *  None.
+   * @par Returns
+   *  Nothing.
+   */
+  void
+  os_startup_create_thread_timer_daemon (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
   /**
    * @}
    */
@@ -155,6 +170,19 @@ extern "C"
   bool
   os_rtos_idle_enter_power_saving_mode_hook (void);
 
+  /**
+   * @brief Hook to sleep with the system clock ticks suppressed.
+   * @param [in] max_ticks The number of ticks up to the earliest
+   *  clock deadline.
+   * @param [out] elapsed_ticks Pointer to the number of ticks
+   *  elapsed while sleeping, not including the pending tick.
+   * @retval true The hook suppressed the ticks.
+   * @retval false The hook did not suppress the ticks.
+   */
+  bool
+  os_rtos_idle_suppress_ticks_hook (uint32_t max_ticks,
+                                    uint32_t* elapsed_ticks);
+
   /**
    * @brief Hook to handle out of memory in the application free store.
    * @par Parameters
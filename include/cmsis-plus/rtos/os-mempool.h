@@ -461,11 +461,17 @@ namespace os
        * @cond ignore
        */
 
+      friend class wait_set;
+
 #if !defined(OS_USE_RTOS_PORT_MEMORY_POOL)
       /**
        * @brief List of threads waiting to alloc.
        */
       internal::waiting_threads_list list_;
+      /**
+       * @brief List of wait sets waiting for free blocks.
+       */
+      internal::waiting_threads_list sets_list_;
       /**
        * @brief Pointer to clock to be used for timeouts.
        */
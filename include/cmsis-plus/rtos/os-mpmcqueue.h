@@ -0,0 +1,718 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CMSIS_PLUS_RTOS_OS_MPMCQUEUE_H_
+#define CMSIS_PLUS_RTOS_OS_MPMCQUEUE_H_
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+
+#include <cmsis-plus/rtos/os-decls.h>
+
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+
+    // ========================================================================
+
+    /**
+     * @brief Lock free **multiple producers, multiple consumers
+     * queue**, with untyped elements.
+     * @headerfile os.h <cmsis-plus/rtos/os.h>
+     * @ingroup cmsis-plus-rtos-mpmcqueue
+     *
+     * @details
+     * A bounded ring of cells, each with a sequence number and
+     * the element. Producers and consumers claim cells by
+     * advancing the enqueue or the dequeue position with
+     * compare-and-swap, and publish them by updating the cell
+     * sequence number, so the non blocking functions never disable
+     * interrupts.
+     *
+     * The blocking functions wait in the usual waiting lists,
+     * and only these slow paths enter critical sections.
+     *
+     * The storage is provided by the user; its size can be computed
+     * with `compute_storage_size_bytes()`. For typed queues with
+     * local storage, use the mpmc_queue template.
+     *
+     * The port must support the GCC `__atomic` compare-and-swap
+     * builtins for `std::size_t` (on Cortex-M, ARMv7-M or higher;
+     * on ARMv6-M they become library calls, which do not link).
+     */
+    class mpmc_queue_base : public internal::object_named_system
+    {
+    public:
+
+      /**
+       * @brief Type of the free running positions.
+       */
+      using index_t = std::size_t;
+
+      /**
+       * @brief Size of the cell header, holding the sequence number.
+       */
+      static constexpr std::size_t cell_header_size_bytes =
+          alignof(std::max_align_t);
+
+      static_assert(cell_header_size_bytes >= sizeof(index_t),
+          "cell header too small");
+
+      /**
+       * @brief Calculate the size of a cell.
+       * @param [in] elem_size_bytes Size of an element, in bytes.
+       * @return The cell size, in bytes.
+       */
+      static constexpr std::size_t
+      compute_cell_size_bytes (std::size_t elem_size_bytes)
+      {
+        return cell_header_size_bytes
+            + ((elem_size_bytes + cell_header_size_bytes - 1)
+                / cell_header_size_bytes) * cell_header_size_bytes;
+      }
+
+      /**
+       * @brief Calculate the queue storage size.
+       * @param [in] capacity Number of elements, a power of 2.
+       * @param [in] elem_size_bytes Size of an element, in bytes.
+       * @return The storage size, in bytes.
+       */
+      static constexpr std::size_t
+      compute_storage_size_bytes (std::size_t capacity,
+                                  std::size_t elem_size_bytes)
+      {
+        return capacity * compute_cell_size_bytes (elem_size_bytes);
+      }
+
+      /**
+       * @name Constructors & Destructor
+       * @{
+       */
+
+      /**
+       * @brief Construct a queue object instance.
+       * @param [in] capacity Number of elements, a power of 2.
+       * @param [in] elem_size_bytes Size of an element, in bytes.
+       * @param [in] storage Pointer to storage, aligned as `std::max_align_t`.
+       * @param [in] storage_size_bytes Size of the storage, in bytes.
+       */
+      mpmc_queue_base (std::size_t capacity, std::size_t elem_size_bytes,
+                       void* storage, std::size_t storage_size_bytes);
+
+      /**
+       * @brief Construct a named queue object instance.
+       * @param [in] name Pointer to name.
+       * @param [in] capacity Number of elements, a power of 2.
+       * @param [in] elem_size_bytes Size of an element, in bytes.
+       * @param [in] storage Pointer to storage, aligned as `std::max_align_t`.
+       * @param [in] storage_size_bytes Size of the storage, in bytes.
+       */
+      mpmc_queue_base (const char* name, std::size_t capacity,
+                       std::size_t elem_size_bytes, void* storage,
+                       std::size_t storage_size_bytes);
+
+    protected:
+
+      /**
+       * @cond ignore
+       */
+
+      // Internal constructor, used from templates.
+      mpmc_queue_base (const char* name);
+
+      /**
+       * @endcond
+       */
+
+    public:
+
+      /**
+       * @cond ignore
+       */
+
+      // The rule of five.
+      mpmc_queue_base (const mpmc_queue_base&) = delete;
+      mpmc_queue_base (mpmc_queue_base&&) = delete;
+      mpmc_queue_base&
+      operator= (const mpmc_queue_base&) = delete;
+      mpmc_queue_base&
+      operator= (mpmc_queue_base&&) = delete;
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @brief Destruct the queue object instance.
+       */
+      ~mpmc_queue_base ();
+
+      /**
+       * @}
+       */
+
+    public:
+
+      /**
+       * @name Public Member Functions
+       * @{
+       */
+
+      /**
+       * @brief Add an element to the queue, without blocking.
+       * @param [in] elem Pointer to the element to copy.
+       * @retval result::ok The element was added to the queue.
+       * @retval EWOULDBLOCK The queue was full.
+       */
+      result_t
+      try_push (const void* elem);
+
+      /**
+       * @brief Add an element to the queue, waiting if the queue is full.
+       * @param [in] elem Pointer to the element to copy.
+       * @retval result::ok The element was added to the queue.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      push (const void* elem);
+
+      /**
+       * @brief Add an element to the queue, waiting if the queue is
+       * full, with timeout.
+       * @param [in] elem Pointer to the element to copy.
+       * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+       * @retval result::ok The element was added to the queue.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ETIMEDOUT The queue remained full until the timeout.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_push (const void* elem, clock::duration_t timeout);
+
+      /**
+       * @brief Remove the oldest element, without blocking.
+       * @param [out] elem Pointer where to copy the element.
+       * @retval result::ok The element was removed from the queue.
+       * @retval EWOULDBLOCK The queue was empty.
+       */
+      result_t
+      try_pop (void* elem);
+
+      /**
+       * @brief Remove the oldest element, waiting if the queue is empty.
+       * @param [out] elem Pointer where to copy the element.
+       * @retval result::ok The element was removed from the queue.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      pop (void* elem);
+
+      /**
+       * @brief Remove the oldest element, waiting if the queue is
+       * empty, with timeout.
+       * @param [out] elem Pointer where to copy the element.
+       * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+       * @retval result::ok The element was removed from the queue.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ETIMEDOUT No element arrived before the timeout.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_pop (void* elem, clock::duration_t timeout);
+
+      /**
+       * @brief Get the number of elements in the queue.
+       * @par Parameters
+       *  None.
+       * @return The number of elements, a snapshot which may already
+       *  be outdated.
+       */
+      std::size_t
+      length (void) const;
+
+      /**
+       * @brief Get the queue capacity.
+       * @par Parameters
+       *  None.
+       * @return The maximum number of elements.
+       */
+      std::size_t
+      capacity (void) const;
+
+      /**
+       * @brief Get the size of an element.
+       * @par Parameters
+       *  None.
+       * @return The number of bytes.
+       */
+      std::size_t
+      elem_size (void) const;
+
+      /**
+       * @brief Check if the queue is empty.
+       * @par Parameters
+       *  None.
+       * @retval true The queue has no elements.
+       * @retval false The queue has at least one element.
+       */
+      bool
+      empty (void) const;
+
+      /**
+       * @brief Check if the queue is full.
+       * @par Parameters
+       *  None.
+       * @retval true The queue has no space for more elements.
+       * @retval false The queue has space for at least one element.
+       */
+      bool
+      full (void) const;
+
+      /**
+       * @}
+       */
+
+    protected:
+
+      /**
+       * @name Private Member Functions
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      void
+      internal_construct_ (std::size_t capacity, std::size_t elem_size_bytes,
+                           void* storage, std::size_t storage_size_bytes);
+
+      index_t*
+      internal_seq_ (index_t pos);
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @}
+       */
+
+    protected:
+
+      /**
+       * @name Private Member Variables
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      index_t enqueue_pos_ = 0;
+      index_t dequeue_pos_ = 0;
+
+      char* storage_ = nullptr;
+      std::size_t mask_ = 0;
+      std::size_t elem_size_bytes_ = 0;
+      std::size_t cell_size_bytes_ = 0;
+
+      internal::waiting_threads_list consumers_list_;
+      internal::waiting_threads_list producers_list_;
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @}
+       */
+    };
+
+    // ========================================================================
+
+    /**
+     * @brief Template of a lock free **multiple producers, multiple
+     * consumers queue** with element type and local storage.
+     * @headerfile os.h <cmsis-plus/rtos/os.h>
+     * @ingroup cmsis-plus-rtos-mpmcqueue
+     *
+     * @details
+     * The elements are copied with `memcpy()`, so they must be
+     * trivially copyable.
+     */
+    template<typename T, std::size_t N>
+      class mpmc_queue : public mpmc_queue_base
+      {
+      public:
+
+        /**
+         * @brief Local type of elements.
+         */
+        using value_type = T;
+
+        /**
+         * @brief Local constant based on template definition.
+         */
+        static constexpr std::size_t elems = N;
+
+        static_assert(N >= 2 && (N & (N - 1)) == 0,
+            "mpmc_queue capacity must be a power of 2");
+        static_assert(std::is_trivially_copyable<T>::value,
+            "mpmc_queue elements must be trivially copyable");
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a typed queue object instance.
+         * @par Parameters
+         *  None.
+         */
+        mpmc_queue ();
+
+        /**
+         * @brief Construct a named typed queue object instance.
+         * @param [in] name Pointer to name.
+         */
+        mpmc_queue (const char* name);
+
+        /**
+         * @cond ignore
+         */
+
+        // The rule of five.
+        mpmc_queue (const mpmc_queue&) = delete;
+        mpmc_queue (mpmc_queue&&) = delete;
+        mpmc_queue&
+        operator= (const mpmc_queue&) = delete;
+        mpmc_queue&
+        operator= (mpmc_queue&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the typed queue object instance.
+         */
+        ~mpmc_queue () = default;
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Functions
+         * @{
+         */
+
+        /**
+         * @brief Add an element to the queue, without blocking.
+         * @param [in] value Reference to the element to copy.
+         * @retval result::ok The element was added to the queue.
+         * @retval EWOULDBLOCK The queue was full.
+         */
+        result_t
+        try_push (const value_type& value);
+
+        /**
+         * @brief Add an element to the queue, waiting if the queue is full.
+         * @param [in] value Reference to the element to copy.
+         * @retval result::ok The element was added to the queue.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        push (const value_type& value);
+
+        /**
+         * @brief Add an element to the queue, waiting if the queue is
+         * full, with timeout.
+         * @param [in] value Reference to the element to copy.
+         * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+         * @retval result::ok The element was added to the queue.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval ETIMEDOUT The queue remained full until the timeout.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        timed_push (const value_type& value, clock::duration_t timeout);
+
+        /**
+         * @brief Remove the oldest element, without blocking.
+         * @param [out] value Reference where to copy the element.
+         * @retval result::ok The element was removed from the queue.
+         * @retval EWOULDBLOCK The queue was empty.
+         */
+        result_t
+        try_pop (value_type& value);
+
+        /**
+         * @brief Remove the oldest element, waiting if the queue is empty.
+         * @param [out] value Reference where to copy the element.
+         * @retval result::ok The element was removed from the queue.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        pop (value_type& value);
+
+        /**
+         * @brief Remove the oldest element, waiting if the queue is
+         * empty, with timeout.
+         * @param [out] value Reference where to copy the element.
+         * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+         * @retval result::ok The element was removed from the queue.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval ETIMEDOUT No element arrived before the timeout.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        timed_pop (value_type& value, clock::duration_t timeout);
+
+        /**
+         * @}
+         */
+
+      protected:
+
+        /**
+         * @cond ignore
+         */
+
+        /**
+         * @brief Local storage for the queue cells.
+         */
+        typename std::aligned_storage<
+            compute_storage_size_bytes (N, sizeof(value_type)),
+            alignof(std::max_align_t)>::type arena_;
+
+        /**
+         * @endcond
+         */
+      };
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ===== Inline & template implementations ====================================
+
+namespace os
+{
+  namespace rtos
+  {
+
+    // ========================================================================
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline std::size_t
+    mpmc_queue_base::length (void) const
+    {
+      index_t dequeue_pos = __atomic_load_n (&dequeue_pos_, __ATOMIC_ACQUIRE);
+      index_t enqueue_pos = __atomic_load_n (&enqueue_pos_, __ATOMIC_ACQUIRE);
+      std::size_t len = static_cast<std::size_t> (enqueue_pos - dequeue_pos);
+      // The two loads are not atomic together, keep the result sane.
+      return (len > (mask_ + 1)) ? (mask_ + 1) : len;
+    }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline std::size_t
+    mpmc_queue_base::capacity (void) const
+    {
+      return mask_ + 1;
+    }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline std::size_t
+    mpmc_queue_base::elem_size (void) const
+    {
+      return elem_size_bytes_;
+    }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline bool
+    mpmc_queue_base::empty (void) const
+    {
+      return (length () == 0);
+    }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline bool
+    mpmc_queue_base::full (void) const
+    {
+      return (length () == capacity ());
+    }
+
+    /**
+     * @cond ignore
+     */
+
+    inline mpmc_queue_base::index_t*
+    mpmc_queue_base::internal_seq_ (index_t pos)
+    {
+      return reinterpret_cast<index_t*> (storage_
+          + (pos & mask_) * cell_size_bytes_);
+    }
+
+    /**
+     * @endcond
+     */
+
+    // ========================================================================
+
+    template<typename T, std::size_t N>
+      mpmc_queue<T, N>::mpmc_queue () :
+          mpmc_queue_base
+            { nullptr }
+      {
+        internal_construct_ (N, sizeof(value_type), &arena_, sizeof(arena_));
+      }
+
+    template<typename T, std::size_t N>
+      mpmc_queue<T, N>::mpmc_queue (const char* name) :
+          mpmc_queue_base
+            { name }
+      {
+        internal_construct_ (N, sizeof(value_type), &arena_, sizeof(arena_));
+      }
+
+    /**
+     * @details
+     * Wrapper over mpmc_queue_base::try_push().
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      mpmc_queue<T, N>::try_push (const value_type& value)
+      {
+        return mpmc_queue_base::try_push (&value);
+      }
+
+    /**
+     * @details
+     * Wrapper over mpmc_queue_base::push().
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      mpmc_queue<T, N>::push (const value_type& value)
+      {
+        return mpmc_queue_base::push (&value);
+      }
+
+    /**
+     * @details
+     * Wrapper over mpmc_queue_base::timed_push().
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      mpmc_queue<T, N>::timed_push (const value_type& value,
+                                    clock::duration_t timeout)
+      {
+        return mpmc_queue_base::timed_push (&value, timeout);
+      }
+
+    /**
+     * @details
+     * Wrapper over mpmc_queue_base::try_pop().
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      mpmc_queue<T, N>::try_pop (value_type& value)
+      {
+        return mpmc_queue_base::try_pop (&value);
+      }
+
+    /**
+     * @details
+     * Wrapper over mpmc_queue_base::pop().
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      mpmc_queue<T, N>::pop (value_type& value)
+      {
+        return mpmc_queue_base::pop (&value);
+      }
+
+    /**
+     * @details
+     * Wrapper over mpmc_queue_base::timed_pop().
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      mpmc_queue<T, N>::timed_pop (value_type& value,
+                                   clock::duration_t timeout)
+      {
+        return mpmc_queue_base::timed_pop (&value, timeout);
+      }
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ----------------------------------------------------------------------------
+
+#endif /* __cplusplus */
+
+#endif /* CMSIS_PLUS_RTOS_OS_MPMCQUEUE_H_ */
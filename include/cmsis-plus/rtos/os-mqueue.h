@@ -137,6 +137,42 @@ namespace os
        */
       static constexpr priority_t max_priority = 0xFF;
 
+      /**
+       * @cond ignore
+       */
+
+      /**
+       * @brief Type of message slot state storage.
+       */
+      using slot_state_t = uint8_t;
+
+      /**
+       * @brief Message slot states.
+       * @details
+       * Kept for each slot, to catch the zero-copy calls with
+       * a slot in the wrong state, like a double `commit()`.
+       */
+      struct slot_state
+      {
+        enum
+          : slot_state_t
+            {
+              // In the free list.
+              free = 0, //
+          // Taken by `loan()`, or by a send in progress.
+          loaned = 1, //
+          // Linked in the queue.
+          queued = 2, //
+          // Taken by `acquire()`, or by a receive in progress.
+          acquired = 3
+        };
+        /* enum  */
+      }; /* struct slot_state */
+
+      /**
+       * @endcond
+       */
+
       // ======================================================================
 
       /**
@@ -223,7 +259,8 @@ namespace os
        * @details
        * Each message is stored in an element
        * extended to a multiple of pointers. The lists are kept in two arrays
-       * of indices and the priorities are kept in a separate array.
+       * of indices and the priorities and the slot states are kept in
+       * separate arrays.
        */
       template<typename T, std::size_t msgs, std::size_t msg_size_bytes>
         class arena
@@ -232,6 +269,7 @@ namespace os
           T queue[(msgs * msg_size_bytes + sizeof(T) - 1) / sizeof(T)];
           T links[((2 * msgs) * sizeof(index_t) + sizeof(T) - 1) / sizeof(T)];
           T prios[(msgs * sizeof(priority_t) + sizeof(T) - 1) / sizeof(T)];
+          T states[(msgs * sizeof(slot_state_t) + sizeof(T) - 1) / sizeof(T)];
         };
 
       /**
@@ -253,6 +291,9 @@ namespace os
                   & ~(sizeof(T) - 1))
               // Align the priority array
               + ((msgs * sizeof(priority_t) + (sizeof(T) - 1))
+                  & ~(sizeof(T) - 1))
+              // Align the slot states array
+              + ((msgs * sizeof(slot_state_t) + (sizeof(T) - 1))
                   & ~(sizeof(T) - 1));
         }
 
@@ -481,6 +522,230 @@ namespace os
       timed_receive (void* msg, std::size_t nbytes, clock::duration_t timeout,
                      priority_t* mprio = nullptr);
 
+      /**
+       * @brief Send an array of messages to the queue.
+       * @param [in] msgs The address of the array of messages, each
+       *  of `msg_size()` bytes.
+       * @param [in] nmsgs The number of messages in the array.
+       * @param [out] sent The address where to store the number
+       *  of messages enqueued, or `nullptr`.
+       * @param [in] mprio The messages priority. The default is 0.
+       * @retval result::ok All messages were enqueued.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      send_many (const void* msgs, std::size_t nmsgs, std::size_t* sent,
+                 priority_t mprio = default_priority);
+
+      /**
+       * @brief Try to send an array of messages to the queue.
+       * @param [in] msgs The address of the array of messages, each
+       *  of `msg_size()` bytes.
+       * @param [in] nmsgs The number of messages in the array.
+       * @param [out] sent The address where to store the number
+       *  of messages enqueued, or `nullptr`.
+       * @param [in] mprio The messages priority. The default is 0.
+       * @retval result::ok At least one message was enqueued.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EWOULDBLOCK The specified message queue is full.
+       */
+      result_t
+      try_send_many (const void* msgs, std::size_t nmsgs, std::size_t* sent,
+                     priority_t mprio = default_priority);
+
+      /**
+       * @brief Send an array of messages to the queue with timeout.
+       * @param [in] msgs The address of the array of messages, each
+       *  of `msg_size()` bytes.
+       * @param [in] nmsgs The number of messages in the array.
+       * @param [out] sent The address where to store the number
+       *  of messages enqueued, or `nullptr`.
+       * @param [in] timeout The timeout duration.
+       * @param [in] mprio The messages priority. The default is 0.
+       * @retval result::ok All messages were enqueued.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval ETIMEDOUT The timeout expired before all messages
+       *  could be added to the queue.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_send_many (const void* msgs, std::size_t nmsgs, std::size_t* sent,
+                       clock::duration_t timeout,
+                       priority_t mprio = default_priority);
+
+      /**
+       * @brief Receive an array of messages from the queue.
+       * @param [out] msgs The address of the array where to store
+       *  the messages, each of `msg_size()` bytes.
+       * @param [in] max_msgs The number of messages in the array.
+       * @param [out] received The address where to store the number
+       *  of messages dequeued.
+       * @param [out] mprios The address of the array where to store
+       *  the messages priorities. The default is `nullptr`.
+       * @retval result::ok At least one message was received.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      receive_many (void* msgs, std::size_t max_msgs, std::size_t* received,
+                    priority_t* mprios = nullptr);
+
+      /**
+       * @brief Try to receive an array of messages from the queue.
+       * @param [out] msgs The address of the array where to store
+       *  the messages, each of `msg_size()` bytes.
+       * @param [in] max_msgs The number of messages in the array.
+       * @param [out] received The address where to store the number
+       *  of messages dequeued.
+       * @param [out] mprios The address of the array where to store
+       *  the messages priorities. The default is `nullptr`.
+       * @retval result::ok At least one message was received.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EWOULDBLOCK The specified message queue is empty.
+       */
+      result_t
+      try_receive_many (void* msgs, std::size_t max_msgs,
+                        std::size_t* received, priority_t* mprios = nullptr);
+
+      /**
+       * @brief Receive an array of messages from the queue with timeout.
+       * @param [out] msgs The address of the array where to store
+       *  the messages, each of `msg_size()` bytes.
+       * @param [in] max_msgs The number of messages in the array.
+       * @param [out] received The address where to store the number
+       *  of messages dequeued.
+       * @param [in] timeout The timeout duration.
+       * @param [out] mprios The address of the array where to store
+       *  the messages priorities. The default is `nullptr`.
+       * @retval result::ok At least one message was received.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EINTR The operation was interrupted.
+       * @retval ETIMEDOUT No message arrived on the queue before the
+       *  specified timeout expired.
+       */
+      result_t
+      timed_receive_many (void* msgs, std::size_t max_msgs,
+                          std::size_t* received, clock::duration_t timeout,
+                          priority_t* mprios = nullptr);
+
+      /**
+       * @brief Borrow a free message slot from the queue.
+       * @param [out] msg The address where to store the slot address.
+       * @retval result::ok A slot was loaned.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      loan (void** msg);
+
+      /**
+       * @brief Try to borrow a free message slot from the queue.
+       * @param [out] msg The address where to store the slot address.
+       * @retval result::ok A slot was loaned.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EWOULDBLOCK The specified message queue is full.
+       */
+      result_t
+      try_loan (void** msg);
+
+      /**
+       * @brief Borrow a free message slot from the queue with timeout.
+       * @param [out] msg The address where to store the slot address.
+       * @param [in] timeout The timeout duration.
+       * @retval result::ok A slot was loaned.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval ETIMEDOUT No slot was freed before the
+       *  specified timeout expired.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_loan (void** msg, clock::duration_t timeout);
+
+      /**
+       * @brief Enqueue a loaned message slot.
+       * @param [in] msg The slot address, as returned by `loan()`.
+       * @param [in] mprio The message priority. The default is 0.
+       * @retval result::ok The message was enqueued.
+       * @retval EINVAL The address is not a slot of this queue,
+       *  or the slot is not loaned.
+       * @retval ENOTSUP The queue is implemented by the port.
+       */
+      result_t
+      commit (void* msg, priority_t mprio = default_priority);
+
+      /**
+       * @brief Dequeue a message, without copying it.
+       * @param [out] msg The address where to store the slot address.
+       * @param [out] mprio The address where to store the message
+       *  priority. The default is `nullptr`.
+       * @retval result::ok A message was dequeued.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      acquire (void** msg, priority_t* mprio = nullptr);
+
+      /**
+       * @brief Try to dequeue a message, without copying it.
+       * @param [out] msg The address where to store the slot address.
+       * @param [out] mprio The address where to store the message
+       *  priority. The default is `nullptr`.
+       * @retval result::ok A message was dequeued.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval EWOULDBLOCK The specified message queue is empty.
+       */
+      result_t
+      try_acquire (void** msg, priority_t* mprio = nullptr);
+
+      /**
+       * @brief Dequeue a message with timeout, without copying it.
+       * @param [out] msg The address where to store the slot address.
+       * @param [in] timeout The timeout duration.
+       * @param [out] mprio The address where to store the message
+       *  priority. The default is `nullptr`.
+       * @retval result::ok A message was dequeued.
+       * @retval EINVAL A parameter is invalid or outside of a permitted range.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP The queue is implemented by the port.
+       * @retval ETIMEDOUT No message arrived on the queue before the
+       *  specified timeout expired.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_acquire (void** msg, clock::duration_t timeout,
+                     priority_t* mprio = nullptr);
+
+      /**
+       * @brief Return a message slot to the queue.
+       * @param [in] msg The slot address, as returned by `acquire()`
+       *  or by `loan()`.
+       * @retval result::ok The slot is free again.
+       * @retval EINVAL The address is not a slot of this queue,
+       *  or the slot is neither loaned nor acquired.
+       * @retval ENOTSUP The queue is implemented by the port.
+       */
+      result_t
+      release (void* msg);
+
       // TODO: check if some kind of peek() is useful.
 
       /**
@@ -595,6 +860,111 @@ namespace os
       internal_try_send_ (const void* msg, std::size_t nbytes,
                           priority_t mprio);
 
+      /**
+       * @brief Internal function used to pass a message directly
+       *  to a waiting receiver, if possible.
+       * @param [in] msg The address of the message.
+       * @param [in] nbytes The length of the message.
+       * @param [in] mprio The message priority.
+       * @retval true The message was copied to the receiver buffer.
+       * @retval false The queue is not empty, or no receiver with
+       *  a buffer is waiting.
+       */
+      bool
+      internal_try_handoff_ (const void* msg, std::size_t nbytes,
+                             priority_t mprio);
+
+      /**
+       * @brief Internal function used to take a free slot, if possible.
+       * @par Parameters
+       *  None.
+       * @return The slot address, or `nullptr` if the queue is full.
+       */
+      char*
+      internal_try_loan_ (void);
+
+      /**
+       * @brief Internal function used to enqueue a loaned slot.
+       * @param [in] msg The slot address.
+       * @param [in] mprio The message priority.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      internal_commit_ (char* msg, priority_t mprio);
+
+      /**
+       * @brief Internal function used to link a slot to the list,
+       *  without resuming a receiver.
+       * @param [in] msg The slot address.
+       * @param [in] mprio The message priority.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      internal_enqueue_ (char* msg, priority_t mprio);
+
+      /**
+       * @brief Internal function used to enqueue as many messages
+       *  as possible.
+       * @param [in] msgs The address of the array of messages.
+       * @param [in] nmsgs The number of messages in the array.
+       * @param [in] mprio The messages priority.
+       * @return The number of messages enqueued.
+       */
+      std::size_t
+      internal_try_send_many_ (const char* msgs, std::size_t nmsgs,
+                               priority_t mprio);
+
+      /**
+       * @brief Internal function used to dequeue as many messages
+       *  as available.
+       * @param [out] msgs The address of the array of messages.
+       * @param [in] max_msgs The number of messages in the array.
+       * @param [out] mprios The address of the array of priorities,
+       *  or `nullptr`.
+       * @return The number of messages dequeued.
+       */
+      std::size_t
+      internal_try_receive_many_ (char* msgs, std::size_t max_msgs,
+                                  priority_t* mprios);
+
+      /**
+       * @brief Internal function used to dequeue a slot, if available.
+       * @param [out] mprio The address where to store the message
+       *  priority.
+       * @return The slot address, or `nullptr` if the queue is empty.
+       */
+      char*
+      internal_try_acquire_ (priority_t* mprio);
+
+      /**
+       * @brief Internal function used to free a slot.
+       * @param [in] msg The slot address.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      internal_release_ (char* msg);
+
+      /**
+       * @brief Internal function used to validate a slot address.
+       * @param [in] msg The slot address.
+       * @retval true The address is a slot of this queue.
+       * @retval false The address is outside the queue storage or
+       *  not at the beginning of a slot.
+       */
+      bool
+      internal_is_slot_ (const void* msg) const;
+
+      /**
+       * @brief Internal function used to compute the index of a slot.
+       * @param [in] msg The slot address.
+       * @return The slot index.
+       */
+      std::size_t
+      internal_slot_index_ (const void* msg) const;
+
       /**
        * @brief Internal function used to dequeue a message, if available.
        * @param [out] msg The address where to store the dequeued message.
@@ -629,6 +999,8 @@ namespace os
        * @cond ignore
        */
 
+      friend class wait_set;
+
       // Keep these in sync with the structure declarations in os-c-decl.h.
 #if !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
       /**
@@ -639,6 +1011,10 @@ namespace os
        * @brief List of threads waiting to receive.
        */
       internal::waiting_threads_list receive_list_;
+      /**
+       * @brief List of wait sets waiting for messages.
+       */
+      internal::waiting_threads_list sets_list_;
       /**
        * @brief Pointer to clock to be used for timeouts.
        */
@@ -658,15 +1034,19 @@ namespace os
        * @brief Pointer to array of priorities.
        */
       volatile priority_t* prio_array_ = nullptr;
+      /**
+       * @brief Pointer to array of slot states.
+       */
+      volatile slot_state_t* state_array_ = nullptr;
 
       /**
        * @brief Pointer to the first free message, or `nullptr`.
        * @details
        * The free messages are in a single linked list, and
        * the allocation strategy is LIFO, messages freed by `receive()`
-       * are added to the beginning, and messages requested by `send()`
-       * are allocated also from the beginning, so only a pointer to
-       * the beginning is required.
+       * or `release()` are added to the beginning, and messages
+       * requested by `send()` or `loan()` are allocated also from the
+       * beginning, so only a pointer to the beginning is required.
        */
       void* volatile first_free_ = nullptr;
 #endif /* !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE) */
@@ -719,6 +1099,22 @@ namespace os
        * @brief Index of the first message in the queue.
        */
       index_t head_ = 0;
+
+#if defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP)
+      /**
+       * @brief Index of the last message of each priority,
+       *  or `no_index`.
+       */
+      index_t tails_[max_priority + 1];
+      /**
+       * @brief One bit for each priority with queued messages.
+       */
+      uint32_t prio_map_[(max_priority + 1) / 32];
+      /**
+       * @brief One bit for each non-zero word in `prio_map_`.
+       */
+      uint32_t prio_summary_ = 0;
+#endif /* defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP) */
 #endif /* !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE) */
 
       /**
@@ -1016,6 +1412,118 @@ namespace os
         timed_receive (value_type* msg, clock::duration_t timeout,
                        message_queue::priority_t* mprio = nullptr);
 
+        /**
+         * @brief Send an array of typed messages to the queue.
+         * @param [in] msgs The address of the array of messages.
+         * @param [in] nmsgs The number of messages in the array.
+         * @param [out] sent The address where to store the number
+         *  of messages enqueued, or `nullptr`.
+         * @param [in] mprio The messages priority. The default is 0.
+         * @retval result::ok All messages were enqueued.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        send_many (const value_type* msgs, std::size_t nmsgs, std::size_t* sent,
+                   message_queue::priority_t mprio = message_queue::default_priority);
+
+        /**
+         * @brief Try to send an array of typed messages to the queue.
+         * @param [in] msgs The address of the array of messages.
+         * @param [in] nmsgs The number of messages in the array.
+         * @param [out] sent The address where to store the number
+         *  of messages enqueued, or `nullptr`.
+         * @param [in] mprio The messages priority. The default is 0.
+         * @retval result::ok At least one message was enqueued.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EWOULDBLOCK The specified message queue is full.
+         */
+        result_t
+        try_send_many (const value_type* msgs, std::size_t nmsgs,
+                       std::size_t* sent,
+                       message_queue::priority_t mprio = message_queue::default_priority);
+
+        /**
+         * @brief Send an array of typed messages to the queue with timeout.
+         * @param [in] msgs The address of the array of messages.
+         * @param [in] nmsgs The number of messages in the array.
+         * @param [out] sent The address where to store the number
+         *  of messages enqueued, or `nullptr`.
+         * @param [in] timeout The timeout duration.
+         * @param [in] mprio The messages priority. The default is 0.
+         * @retval result::ok All messages were enqueued.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval ETIMEDOUT The timeout expired before all messages
+         *  could be added to the queue.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        timed_send_many (const value_type* msgs, std::size_t nmsgs,
+                         std::size_t* sent, clock::duration_t timeout,
+                         message_queue::priority_t mprio = message_queue::default_priority);
+
+        /**
+         * @brief Receive an array of typed messages from the queue.
+         * @param [out] msgs The address of the array where to store
+         *  the messages.
+         * @param [in] max_msgs The number of messages in the array.
+         * @param [out] received The address where to store the number
+         *  of messages dequeued.
+         * @param [out] mprios The address of the array where to store
+         *  the messages priorities. The default is `nullptr`.
+         * @retval result::ok At least one message was received.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        receive_many (value_type* msgs, std::size_t max_msgs,
+                      std::size_t* received,
+                      message_queue::priority_t* mprios = nullptr);
+
+        /**
+         * @brief Try to receive an array of typed messages from the queue.
+         * @param [out] msgs The address of the array where to store
+         *  the messages.
+         * @param [in] max_msgs The number of messages in the array.
+         * @param [out] received The address where to store the number
+         *  of messages dequeued.
+         * @param [out] mprios The address of the array where to store
+         *  the messages priorities. The default is `nullptr`.
+         * @retval result::ok At least one message was received.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EWOULDBLOCK The specified message queue is empty.
+         */
+        result_t
+        try_receive_many (value_type* msgs, std::size_t max_msgs,
+                          std::size_t* received,
+                          message_queue::priority_t* mprios = nullptr);
+
+        /**
+         * @brief Receive an array of typed messages from the queue
+         *  with timeout.
+         * @param [out] msgs The address of the array where to store
+         *  the messages.
+         * @param [in] max_msgs The number of messages in the array.
+         * @param [out] received The address where to store the number
+         *  of messages dequeued.
+         * @param [in] timeout The timeout duration.
+         * @param [out] mprios The address of the array where to store
+         *  the messages priorities. The default is `nullptr`.
+         * @retval result::ok At least one message was received.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         * @retval ETIMEDOUT No message arrived on the queue before the
+         *  specified timeout expired.
+         */
+        result_t
+        timed_receive_many (value_type* msgs, std::size_t max_msgs,
+                            std::size_t* received, clock::duration_t timeout,
+                            message_queue::priority_t* mprios = nullptr);
+
         /**
          * @}
          */
@@ -1210,6 +1718,118 @@ namespace os
         timed_receive (value_type* msg, clock::duration_t timeout,
                        priority_t* mprio = nullptr);
 
+        /**
+         * @brief Send an array of typed messages to the queue.
+         * @param [in] msgs The address of the array of messages.
+         * @param [in] nmsgs The number of messages in the array.
+         * @param [out] sent The address where to store the number
+         *  of messages enqueued, or `nullptr`.
+         * @param [in] mprio The messages priority. The default is 0.
+         * @retval result::ok All messages were enqueued.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        send_many (const value_type* msgs, std::size_t nmsgs, std::size_t* sent,
+                   priority_t mprio = default_priority);
+
+        /**
+         * @brief Try to send an array of typed messages to the queue.
+         * @param [in] msgs The address of the array of messages.
+         * @param [in] nmsgs The number of messages in the array.
+         * @param [out] sent The address where to store the number
+         *  of messages enqueued, or `nullptr`.
+         * @param [in] mprio The messages priority. The default is 0.
+         * @retval result::ok At least one message was enqueued.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EWOULDBLOCK The specified message queue is full.
+         */
+        result_t
+        try_send_many (const value_type* msgs, std::size_t nmsgs,
+                       std::size_t* sent,
+                       priority_t mprio = default_priority);
+
+        /**
+         * @brief Send an array of typed messages to the queue with timeout.
+         * @param [in] msgs The address of the array of messages.
+         * @param [in] nmsgs The number of messages in the array.
+         * @param [out] sent The address where to store the number
+         *  of messages enqueued, or `nullptr`.
+         * @param [in] timeout The timeout duration.
+         * @param [in] mprio The messages priority. The default is 0.
+         * @retval result::ok All messages were enqueued.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval ETIMEDOUT The timeout expired before all messages
+         *  could be added to the queue.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        timed_send_many (const value_type* msgs, std::size_t nmsgs,
+                         std::size_t* sent, clock::duration_t timeout,
+                         priority_t mprio = default_priority);
+
+        /**
+         * @brief Receive an array of typed messages from the queue.
+         * @param [out] msgs The address of the array where to store
+         *  the messages.
+         * @param [in] max_msgs The number of messages in the array.
+         * @param [out] received The address where to store the number
+         *  of messages dequeued.
+         * @param [out] mprios The address of the array where to store
+         *  the messages priorities. The default is `nullptr`.
+         * @retval result::ok At least one message was received.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        receive_many (value_type* msgs, std::size_t max_msgs,
+                      std::size_t* received,
+                      priority_t* mprios = nullptr);
+
+        /**
+         * @brief Try to receive an array of typed messages from the queue.
+         * @param [out] msgs The address of the array where to store
+         *  the messages.
+         * @param [in] max_msgs The number of messages in the array.
+         * @param [out] received The address where to store the number
+         *  of messages dequeued.
+         * @param [out] mprios The address of the array where to store
+         *  the messages priorities. The default is `nullptr`.
+         * @retval result::ok At least one message was received.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EWOULDBLOCK The specified message queue is empty.
+         */
+        result_t
+        try_receive_many (value_type* msgs, std::size_t max_msgs,
+                          std::size_t* received,
+                          priority_t* mprios = nullptr);
+
+        /**
+         * @brief Receive an array of typed messages from the queue
+         *  with timeout.
+         * @param [out] msgs The address of the array where to store
+         *  the messages.
+         * @param [in] max_msgs The number of messages in the array.
+         * @param [out] received The address where to store the number
+         *  of messages dequeued.
+         * @param [in] timeout The timeout duration.
+         * @param [out] mprios The address of the array where to store
+         *  the messages priorities. The default is `nullptr`.
+         * @retval result::ok At least one message was received.
+         * @retval EINVAL A parameter is invalid or outside of a permitted range.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         * @retval ETIMEDOUT No message arrived on the queue before the
+         *  specified timeout expired.
+         */
+        result_t
+        timed_receive_many (value_type* msgs, std::size_t max_msgs,
+                            std::size_t* received, clock::duration_t timeout,
+                            priority_t* mprios = nullptr);
+
         /**
          * @}
          */
@@ -1687,6 +2307,108 @@ namespace os
             reinterpret_cast<char*> (msg), sizeof(value_type), timeout, mprio);
       }
 
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::send_many().
+     */
+    template<typename T, typename Allocator>
+      inline result_t
+      message_queue_typed<T, Allocator>::send_many (
+          const value_type* msgs, std::size_t nmsgs, std::size_t* sent,
+          message_queue::priority_t mprio)
+      {
+        return message_queue_allocated<allocator_type>::send_many (
+            msgs, nmsgs, sent, mprio);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::try_send_many().
+     */
+    template<typename T, typename Allocator>
+      inline result_t
+      message_queue_typed<T, Allocator>::try_send_many (
+          const value_type* msgs, std::size_t nmsgs, std::size_t* sent,
+          message_queue::priority_t mprio)
+      {
+        return message_queue_allocated<allocator_type>::try_send_many (
+            msgs, nmsgs, sent, mprio);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::timed_send_many().
+     */
+    template<typename T, typename Allocator>
+      inline result_t
+      message_queue_typed<T, Allocator>::timed_send_many (
+          const value_type* msgs, std::size_t nmsgs, std::size_t* sent,
+          clock::duration_t timeout, message_queue::priority_t mprio)
+      {
+        return message_queue_allocated<allocator_type>::timed_send_many (
+            msgs, nmsgs, sent, timeout, mprio);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::receive_many().
+     */
+    template<typename T, typename Allocator>
+      inline result_t
+      message_queue_typed<T, Allocator>::receive_many (
+          value_type* msgs, std::size_t max_msgs, std::size_t* received,
+          message_queue::priority_t* mprios)
+      {
+        return message_queue_allocated<allocator_type>::receive_many (
+            msgs, max_msgs, received, mprios);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::try_receive_many().
+     */
+    template<typename T, typename Allocator>
+      inline result_t
+      message_queue_typed<T, Allocator>::try_receive_many (
+          value_type* msgs, std::size_t max_msgs, std::size_t* received,
+          message_queue::priority_t* mprios)
+      {
+        return message_queue_allocated<allocator_type>::try_receive_many (
+            msgs, max_msgs, received, mprios);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::timed_receive_many().
+     */
+    template<typename T, typename Allocator>
+      inline result_t
+      message_queue_typed<T, Allocator>::timed_receive_many (
+          value_type* msgs, std::size_t max_msgs, std::size_t* received,
+          clock::duration_t timeout, message_queue::priority_t* mprios)
+      {
+        return message_queue_allocated<allocator_type>::timed_receive_many (
+            msgs, max_msgs, received, timeout, mprios);
+      }
+
     // ========================================================================
 
     /**
@@ -1893,6 +2615,111 @@ namespace os
                                              sizeof(value_type), timeout, mprio);
       }
 
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::send_many().
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      message_queue_inclusive<T, N>::send_many (const value_type* msgs,
+                                                std::size_t nmsgs,
+                                                std::size_t* sent,
+                                                priority_t mprio)
+      {
+        return message_queue::send_many (msgs, nmsgs, sent, mprio);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::try_send_many().
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      message_queue_inclusive<T, N>::try_send_many (const value_type* msgs,
+                                                    std::size_t nmsgs,
+                                                    std::size_t* sent,
+                                                    priority_t mprio)
+      {
+        return message_queue::try_send_many (msgs, nmsgs, sent, mprio);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::timed_send_many().
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      message_queue_inclusive<T, N>::timed_send_many (const value_type* msgs,
+                                                      std::size_t nmsgs,
+                                                      std::size_t* sent,
+                                                      clock::duration_t timeout,
+                                                      priority_t mprio)
+      {
+        return message_queue::timed_send_many (
+            msgs, nmsgs, sent, timeout, mprio);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::receive_many().
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      message_queue_inclusive<T, N>::receive_many (value_type* msgs,
+                                                   std::size_t max_msgs,
+                                                   std::size_t* received,
+                                                   priority_t* mprios)
+      {
+        return message_queue::receive_many (msgs, max_msgs, received, mprios);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::try_receive_many().
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      message_queue_inclusive<T, N>::try_receive_many (value_type* msgs,
+                                                       std::size_t max_msgs,
+                                                       std::size_t* received,
+                                                       priority_t* mprios)
+      {
+        return message_queue::try_receive_many (
+            msgs, max_msgs, received, mprios);
+      }
+
+    /**
+     * @details
+     * Wrapper over the parent method; the message size
+     * is the size of the type.
+     *
+     * @see message_queue::timed_receive_many().
+     */
+    template<typename T, std::size_t N>
+      inline result_t
+      message_queue_inclusive<T, N>::timed_receive_many (
+          value_type* msgs, std::size_t max_msgs, std::size_t* received,
+          clock::duration_t timeout, priority_t* mprios)
+      {
+        return message_queue::timed_receive_many (
+            msgs, max_msgs, received, timeout, mprios);
+      }
+
   } /* namespace rtos */
 } /* namespace os */
 
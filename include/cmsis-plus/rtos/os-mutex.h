@@ -355,6 +355,172 @@ namespace os
        */
       static const attributes_recursive initializer_recursive;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+      // ======================================================================
+
+      /**
+       * @brief Mutex statistics.
+       * @headerfile os.h <cmsis-plus/rtos/os.h>
+       * @ingroup cmsis-plus-rtos-mutex
+       *
+       * @details
+       * Durations are measured in `hrclock` cycles.
+       */
+      class statistics
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a mutex statistics object instance.
+         * @par Parameters
+         *  None.
+         */
+        statistics () = default;
+
+        /**
+         * @cond ignore
+         */
+
+        // The rule of five.
+        statistics (const statistics&) = delete;
+        statistics (statistics&&) = delete;
+        statistics&
+        operator= (const statistics&) = delete;
+        statistics&
+        operator= (statistics&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the mutex statistics object instance.
+         */
+        ~statistics () = default;
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Functions
+         * @{
+         */
+
+        /**
+         * @brief Get the number of times the mutex was acquired.
+         * @par Parameters
+         *  None.
+         * @return A long integer; recursive relocks are not counted.
+         */
+        rtos::statistics::counter_t
+        acquisitions (void);
+
+        /**
+         * @brief Get the number of acquisitions that had to wait.
+         * @par Parameters
+         *  None.
+         * @return A long integer with the number of contended acquisitions.
+         */
+        rtos::statistics::counter_t
+        contended_acquisitions (void);
+
+        /**
+         * @brief Get the total time spent waiting for the mutex.
+         * @par Parameters
+         *  None.
+         * @return A long integer with accumulated number of cycles.
+         */
+        rtos::statistics::duration_t
+        wait_cycles (void);
+
+        /**
+         * @brief Get the longest wait for the mutex.
+         * @par Parameters
+         *  None.
+         * @return A long integer with the number of cycles.
+         */
+        rtos::statistics::duration_t
+        max_wait_cycles (void);
+
+        /**
+         * @brief Get the total time the mutex was held.
+         * @par Parameters
+         *  None.
+         * @return A long integer with accumulated number of cycles.
+         */
+        rtos::statistics::duration_t
+        hold_cycles (void);
+
+        /**
+         * @brief Get the longest time the mutex was held.
+         * @par Parameters
+         *  None.
+         * @return A long integer with the number of cycles.
+         */
+        rtos::statistics::duration_t
+        max_hold_cycles (void);
+
+        /**
+         * @brief Get the number of times priority inheritance
+         *  boosted the owner.
+         * @par Parameters
+         *  None.
+         * @return A long integer with the number of boosts.
+         */
+        rtos::statistics::counter_t
+        boosts (void);
+
+        /**
+         * @brief Clear all counters.
+         * @par Parameters
+         *  None.
+         * @par Returns
+         *  Nothing.
+         */
+        void
+        clear (void);
+
+        /**
+         * @}
+         */
+
+      protected:
+
+        /**
+         * @cond ignore
+         */
+
+        friend class mutex;
+
+        rtos::statistics::counter_t acquisitions_ = 0;
+        rtos::statistics::counter_t contended_acquisitions_ = 0;
+        rtos::statistics::duration_t wait_cycles_ = 0;
+        rtos::statistics::duration_t max_wait_cycles_ = 0;
+        rtos::statistics::duration_t hold_cycles_ = 0;
+        rtos::statistics::duration_t max_hold_cycles_ = 0;
+        rtos::statistics::counter_t boosts_ = 0;
+
+        // The hrclock time stamp of the last acquisition;
+        // zero when the hold time was already accounted.
+        clock::timestamp_t lock_timestamp_ = 0;
+
+        /**
+         * @endcond
+         */
+
+      };
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
       /**
        * @name Constructors & Destructor
        * @{
@@ -597,6 +763,29 @@ namespace os
       result_t
       reset (void);
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+      /**
+       * @brief Get the mutex statistics.
+       * @par Parameters
+       *  None.
+       * @return A reference to the statistics object.
+       */
+      class mutex::statistics&
+      statistics (void);
+
+      /**
+       * @brief Print the mutex statistics.
+       * @par Parameters
+       *  None.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      trace_print_statistics (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
       /**
        * @}
        */
@@ -604,6 +793,7 @@ namespace os
     protected:
 
       friend class thread;
+      friend class condition_variable;
 
       /**
        * @name Private Member Functions
@@ -635,6 +825,79 @@ namespace os
       void
       internal_mark_owner_dead_ (void);
 
+      /**
+       * @brief Get the owner, without the contended flag.
+       */
+      thread*
+      internal_owner_ (void) const;
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+      /**
+       * @brief Account an acquisition.
+       */
+      void
+      internal_stats_acquired_ (void);
+
+      /**
+       * @brief Account the wait of an acquisition.
+       * @param [in] wait_begin The hrclock time stamp when the thread
+       *  started to wait.
+       */
+      void
+      internal_stats_contended_ (clock::timestamp_t wait_begin);
+
+      /**
+       * @brief Account the hold time, before the mutex is released.
+       */
+      void
+      internal_stats_released_ (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
+#if !defined(OS_USE_RTOS_PORT_MUTEX)
+
+      /**
+       * @brief Move a thread waiting on a condition variable to the
+       *  mutex waiting list, if the mutex is owned by the current thread.
+       * @param [in] node Reference to the unlinked waiting node.
+       * @retval true The node was moved.
+       * @retval false The thread must be resumed.
+       */
+      bool
+      internal_morph_ (internal::waiting_thread_node& node);
+
+#endif
+
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX)
+
+      /**
+       * @brief Check if the mutex can be locked/unlocked
+       *  with a single compare-and-swap.
+       */
+      bool
+      internal_fast_path_ (void) const;
+
+      /**
+       * @brief Try to lock an unlocked mutex with a single
+       *  compare-and-swap.
+       * @retval true The mutex was locked.
+       * @retval false The slow path must be used.
+       */
+      bool
+      internal_fast_lock_ (thread* crt_thread);
+
+      /**
+       * @brief Try to unlock an uncontended mutex with a single
+       *  compare-and-swap.
+       * @retval true The mutex was unlocked.
+       * @retval false The slow path must be used.
+       */
+      bool
+      internal_fast_unlock_ (thread* crt_thread);
+
+#endif
+
       /**
        * @endcond
        */
@@ -655,6 +918,8 @@ namespace os
        */
 
       // Can be updated in different thread contexts.
+      // With the fast path, bit 0 is set when threads may be waiting,
+      // which forces unlock() on the slow path.
       thread* volatile owner_ = nullptr;
 
 #if !defined(OS_USE_RTOS_PORT_MUTEX)
@@ -668,6 +933,40 @@ namespace os
       // This is used for priority inheritance and robustness.
       utils::double_list_links owner_links_;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+      // Intrusive node used to link this mutex to the list of all
+      // mutexes, to enumerate them for statistics.
+      utils::double_list_links statistics_links_;
+
+      /**
+       * @brief List of all mutexes.
+       */
+      using statistics_list = utils::intrusive_list<
+      mutex, utils::double_list_links, &mutex::statistics_links_>;
+
+      /**
+       * @brief Get the list of all mutexes, to enumerate
+       *  their statistics.
+       * @par Parameters
+       *  None.
+       * @return A reference to the list.
+       */
+      static statistics_list&
+      statistics_mutexes (void);
+
+      /**
+       * @brief Print the statistics of all mutexes.
+       * @par Parameters
+       *  None.
+       * @par Returns
+       *  Nothing.
+       */
+      static void
+      trace_print_all_statistics (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
     protected:
 
 #if defined(OS_USE_RTOS_PORT_MUTEX)
@@ -694,6 +993,10 @@ namespace os
       const robustness_t robustness_; // stalled, robust
       const count_t max_count_;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+      class statistics statistics_;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
       // Add more internal data.
 
       /**
@@ -841,9 +1144,41 @@ namespace os
     inline thread*
     mutex::owner (void)
     {
+      return internal_owner_ ();
+    }
+
+    /**
+     * @cond ignore
+     */
+
+    inline thread*
+    mutex::internal_owner_ (void) const
+    {
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX)
+      return reinterpret_cast<thread*> (reinterpret_cast<uintptr_t> (owner_)
+          & ~static_cast<uintptr_t> (1));
+#else
       return owner_;
+#endif
+    }
+
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX)
+
+    inline bool
+    mutex::internal_fast_path_ (void) const
+    {
+      // Recursive mutexes need the counter, robust ones the owner
+      // list and protected ones the priority boost.
+      return (type_ != type::recursive) && (protocol_ != protocol::protect)
+          && (robustness_ != robustness::robust);
     }
 
+#endif
+
+    /**
+     * @endcond
+     */
+
     /**
      * @details
      *
@@ -877,6 +1212,126 @@ namespace os
       return robustness_;
     }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+    // ========================================================================
+
+    /**
+     * @details
+     * The first lock by a thread; recursive relocks are not counted.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::counter_t
+    mutex::statistics::acquisitions (void)
+    {
+      return acquisitions_;
+    }
+
+    /**
+     * @details
+     * Acquisitions by threads that found the mutex locked
+     * and had to wait, in `lock()` or `timed_lock()`.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::counter_t
+    mutex::statistics::contended_acquisitions (void)
+    {
+      return contended_acquisitions_;
+    }
+
+    /**
+     * @details
+     * The sum of the waits of the contended acquisitions;
+     * waits ended by a timeout are not counted.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::duration_t
+    mutex::statistics::wait_cycles (void)
+    {
+      return wait_cycles_;
+    }
+
+    /**
+     * @details
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::duration_t
+    mutex::statistics::max_wait_cycles (void)
+    {
+      return max_wait_cycles_;
+    }
+
+    /**
+     * @details
+     * The sum of the times between acquisition and release.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::duration_t
+    mutex::statistics::hold_cycles (void)
+    {
+      return hold_cycles_;
+    }
+
+    /**
+     * @details
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::duration_t
+    mutex::statistics::max_hold_cycles (void)
+    {
+      return max_hold_cycles_;
+    }
+
+    /**
+     * @details
+     * The number of times a thread blocked on a
+     * mutex::protocol::inherit mutex raised the owner priority.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline rtos::statistics::counter_t
+    mutex::statistics::boosts (void)
+    {
+      return boosts_;
+    }
+
+    /**
+     * @details
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    inline class mutex::statistics&
+    mutex::statistics (void)
+    {
+      return statistics_;
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
     // ========================================================================
 
     inline
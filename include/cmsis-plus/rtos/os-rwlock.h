@@ -0,0 +1,481 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CMSIS_PLUS_RTOS_OS_RWLOCK_H_
+#define CMSIS_PLUS_RTOS_OS_RWLOCK_H_
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+
+#include <cmsis-plus/rtos/os-decls.h>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+
+    // ========================================================================
+
+    /**
+     * @brief POSIX compliant **read-write lock**.
+     * @headerfile os.h <cmsis-plus/rtos/os.h>
+     * @ingroup cmsis-plus-rtos-rwlock
+     */
+    class rwlock : public internal::object_named_system
+    {
+    public:
+
+      /**
+       * @brief Type of variables holding read lock counters.
+       */
+      using count_t = uint16_t;
+
+      /**
+       * @brief Constant with the maximum value for the readers counter.
+       */
+      static constexpr count_t max_count = 0xFFFF;
+
+      // ======================================================================
+
+      /**
+       * @brief Read-write lock attributes.
+       * @headerfile os.h <cmsis-plus/rtos/os.h>
+       * @ingroup cmsis-plus-rtos-rwlock
+       */
+      class attributes : public internal::attributes_clocked
+      {
+      public:
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a read-write lock attributes object instance.
+         * @par Parameters
+         *  None.
+         */
+        constexpr
+        attributes ();
+
+        // The rule of five.
+        attributes (const attributes&) = default;
+        attributes (attributes&&) = default;
+        attributes&
+        operator= (const attributes&) = default;
+        attributes&
+        operator= (attributes&&) = default;
+
+        /**
+         * @brief Destruct the read-write lock attributes object instance.
+         */
+        ~attributes () = default;
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Variables
+         * @{
+         */
+
+        // Public members; no accessors and mutators required.
+        // Warning: must match the type & order of the C file header.
+        /**
+         * @brief Attribute with the maximum number of concurrent readers.
+         */
+        count_t rw_max_readers = max_count;
+
+        // Add more attributes here.
+
+        /**
+         * @}
+         */
+
+      }; /* class attributes */
+
+      /**
+       * @brief Default read-write lock initialiser.
+       * @ingroup cmsis-plus-rtos-rwlock
+       */
+      static const attributes initializer;
+
+      // ======================================================================
+
+      /**
+       * @name Constructors & Destructor
+       * @{
+       */
+
+      /**
+       * @brief Construct a read-write lock object instance.
+       * @param [in] attr Reference to attributes.
+       * @par Errors
+       *  The constructor shall fail if:
+       *  - `EAGAIN` - The system lacked the necessary resources
+       *  (other than memory) to create the read-write lock.
+       *  - `ENOMEM` - Insufficient memory exists to initialise
+       *  the read-write lock.
+       * @par
+       *  The constructor shall not fail with an error code of `EINTR`.
+       */
+      rwlock (const attributes& attr = initializer);
+
+      /**
+       * @brief Construct a named read-write lock object instance.
+       * @param [in] name Pointer to name.
+       * @param [in] attr Reference to attributes.
+       * @par Errors
+       *  The constructor shall fail if:
+       *  - `EAGAIN` - The system lacked the necessary resources
+       *  (other than memory) to create the read-write lock.
+       *  - `ENOMEM` - Insufficient memory exists to initialise
+       *  the read-write lock.
+       * @par
+       *  The constructor shall not fail with an error code of `EINTR`.
+       */
+      rwlock (const char* name, const attributes& attr = initializer);
+
+      /**
+       * @cond ignore
+       */
+
+      // The rule of five.
+      rwlock (const rwlock&) = delete;
+      rwlock (rwlock&&) = delete;
+      rwlock&
+      operator= (const rwlock&) = delete;
+      rwlock&
+      operator= (rwlock&&) = delete;
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @brief Destruct the read-write lock object instance.
+       */
+      ~rwlock ();
+
+      /**
+       * @}
+       */
+
+      /**
+       * @name Operators
+       * @{
+       */
+
+      /**
+       * @brief Compare read-write locks.
+       * @retval true The given read-write lock is the same as
+       *  this read-write lock.
+       * @retval false The read-write locks are different.
+       */
+      bool
+      operator== (const rwlock& rhs) const;
+
+      /**
+       * @}
+       */
+
+    public:
+
+      /**
+       * @name Public Member Functions
+       * @{
+       */
+
+      /**
+       * @brief Lock the read-write lock for reading.
+       * @par Parameters
+       *  None.
+       * @retval result::ok The read lock was acquired.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EAGAIN The maximum number of read locks has been exceeded.
+       * @retval EDEADLK The current thread already owns the
+       *  read-write lock for writing.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      read_lock (void);
+
+      /**
+       * @brief Try to lock the read-write lock for reading.
+       * @par Parameters
+       *  None.
+       * @retval result::ok The read lock was acquired.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EAGAIN The maximum number of read locks has been exceeded.
+       * @retval EDEADLK The current thread already owns the
+       *  read-write lock for writing.
+       * @retval EWOULDBLOCK The read-write lock is locked for writing,
+       *  or writers are waiting.
+       */
+      result_t
+      try_read_lock (void);
+
+      /**
+       * @brief Timed attempt to lock the read-write lock for reading.
+       * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+       * @retval result::ok The read lock was acquired.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EAGAIN The maximum number of read locks has been exceeded.
+       * @retval EDEADLK The current thread already owns the
+       *  read-write lock for writing.
+       * @retval ETIMEDOUT The read lock could not be acquired before the
+       *  specified timeout expired.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_read_lock (clock::duration_t timeout);
+
+      /**
+       * @brief Lock the read-write lock for writing.
+       * @par Parameters
+       *  None.
+       * @retval result::ok The write lock was acquired.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EDEADLK The current thread already owns the
+       *  read-write lock for writing.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      write_lock (void);
+
+      /**
+       * @brief Try to lock the read-write lock for writing.
+       * @par Parameters
+       *  None.
+       * @retval result::ok The write lock was acquired.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EDEADLK The current thread already owns the
+       *  read-write lock for writing.
+       * @retval EWOULDBLOCK The read-write lock is locked for
+       *  reading or writing.
+       */
+      result_t
+      try_write_lock (void);
+
+      /**
+       * @brief Timed attempt to lock the read-write lock for writing.
+       * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+       * @retval result::ok The write lock was acquired.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EDEADLK The current thread already owns the
+       *  read-write lock for writing.
+       * @retval ETIMEDOUT The write lock could not be acquired before the
+       *  specified timeout expired.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_write_lock (clock::duration_t timeout);
+
+      /**
+       * @brief Unlock the read-write lock.
+       * @par Parameters
+       *  None.
+       * @retval result::ok The lock was released.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the read-write lock is not locked.
+       */
+      result_t
+      unlock (void);
+
+      /**
+       * @brief Get the thread that owns the write lock.
+       * @par Parameters
+       *  None.
+       * @return Pointer to thread or `nullptr` if not locked for writing.
+       */
+      thread*
+      writer (void);
+
+      /**
+       * @brief Get the number of read locks.
+       * @par Parameters
+       *  None.
+       * @return The number of threads holding the lock for reading.
+       */
+      count_t
+      readers (void);
+
+      /**
+       * @}
+       */
+
+    protected:
+
+      friend class thread;
+
+      /**
+       * @name Private Member Functions
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      result_t
+      internal_try_read_lock_ (thread* crt_thread);
+
+      result_t
+      internal_try_write_lock_ (thread* crt_thread);
+
+      result_t
+      internal_lock_ (bool write, clock::duration_t* timeout);
+
+      void
+      internal_boost_writer_ (thread* crt_thread);
+
+      void
+      internal_resume_waiting_ (void);
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @}
+       */
+
+    protected:
+
+      /**
+       * @name Private Member Variables
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      // Can be updated in different thread contexts.
+      thread* volatile writer_ = nullptr;
+
+      internal::waiting_threads_list readers_list_;
+      internal::waiting_threads_list writers_list_;
+      clock* clock_ = nullptr;
+
+      // Can be updated in different thread contexts.
+      volatile count_t readers_ = 0;
+      // Writers blocked in the write locks; while non zero,
+      // new readers wait (writer preference).
+      volatile count_t writers_waiting_ = 0;
+
+    public:
+
+      // Intrusive node used to link this lock to the writer thread,
+      // while the writer is boosted by threads blocked on it.
+      utils::double_list_links owner_links_;
+
+    protected:
+
+      // The highest priority of the threads that blocked while the
+      // lock was held for writing, or none.
+      volatile thread::priority_t boosted_prio_ = thread::priority::none;
+
+      // Constants set during construction.
+      const count_t max_readers_;
+
+      /**
+       * @endcond
+       */
+
+      // Add more internal data.
+
+      /**
+       * @}
+       */
+
+    };
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ===== Inline & template implementations ====================================
+
+namespace os
+{
+  namespace rtos
+  {
+    constexpr
+    rwlock::attributes::attributes ()
+    {
+      ;
+    }
+
+    // ========================================================================
+
+    /**
+     * @details
+     * Identical read-write locks should have the same memory address.
+     */
+    inline bool
+    rwlock::operator== (const rwlock& rhs) const
+    {
+      return this == &rhs;
+    }
+
+    /**
+     * @details
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    inline thread*
+    rwlock::writer (void)
+    {
+      return writer_;
+    }
+
+    /**
+     * @details
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    inline rwlock::count_t
+    rwlock::readers (void)
+    {
+      return readers_;
+    }
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ----------------------------------------------------------------------------
+
+#endif /* __cplusplus */
+
+#endif /* CMSIS_PLUS_RTOS_OS_RWLOCK_H_ */
@@ -163,6 +163,14 @@ namespace os
       void
       internal_switch_threads (void);
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) \
+  && !defined(OS_USE_RTOS_PORT_SCHEDULER)
+
+      void
+      internal_check_quantum (void);
+
+#endif
+
       /**
        * @endcond
        */
@@ -474,6 +482,29 @@ namespace os
 
 #endif /* defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CPU_CYCLES) */
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+
+        /**
+         * @brief Get the longest time spent with interrupts masked
+         * while processing expired clock time stamps.
+         * @return Integer with the number of high resolution
+         * clock cycles.
+         */
+        rtos::statistics::duration_t
+        clock_expiry_max_masked_cycles (void);
+
+        /**
+         * @cond ignore
+         */
+
+        extern rtos::statistics::duration_t clock_expiry_max_masked_cycles_;
+
+        /**
+         * @endcond
+         */
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY) */
+
       } /* namespace statistics */
     } /* namespace scheduler */
 
@@ -1078,6 +1109,32 @@ namespace os
 
 #endif /* defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CPU_CYCLES) */
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+
+        /**
+         * @details
+         * Each time the clocks check the expired time stamps, the
+         * duration of every interrupts critical section is measured
+         * with the high resolution clock, and the maximum is kept.
+         *
+         * This value can be used to compare the worst case
+         * interrupts latency added by the regular and the batched
+         * (@ref OS_USE_RTOS_CLOCK_BATCH_EXPIRY) expiry paths.
+         *
+         * @note This function is available only when
+         * @ref OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY
+         * is defined.
+         *
+         * @warning Cannot be invoked from Interrupt Service Routines.
+         */
+        inline rtos::statistics::duration_t
+        clock_expiry_max_masked_cycles (void)
+        {
+          return clock_expiry_max_masked_cycles_;
+        }
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY) */
+
       } /* namespace statistics */
 
     } /* namespace scheduler */
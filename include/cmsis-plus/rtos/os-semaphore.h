@@ -345,6 +345,19 @@ namespace os
       result_t
       post (void);
 
+      /**
+       * @brief Post (unlock) the semaphore several times at once.
+       * @param [in] n Number of units to add to the count.
+       * @retval result::ok The semaphore was posted.
+       * @retval EINVAL The number of units is not positive.
+       * @retval EAGAIN The maximum count value would be exceeded;
+       *  the count was not changed.
+       * @retval ENOTRECOVERABLE The semaphore could not be posted
+       *  (extension to POSIX).
+       */
+      result_t
+      post (count_t n);
+
       /**
        * @brief Lock the semaphore, possibly waiting.
        * @par Parameters
@@ -359,6 +372,21 @@ namespace os
       result_t
       wait (void);
 
+      /**
+       * @brief Lock several units of the semaphore, possibly waiting.
+       * @param [in] n Number of units to take from the count.
+       * @retval result::ok The calling process successfully
+       *  performed the semaphore lock operation.
+       * @retval EINVAL The number of units is not positive or
+       *  exceeds the maximum count value.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ENOTSUP More than one unit, with a port implementation.
+       * @retval ENOTRECOVERABLE Semaphore wait failed (extension to POSIX).
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      wait (count_t n);
+
       /**
        * @brief Try to lock the semaphore.
        * @par Parameters
@@ -374,6 +402,20 @@ namespace os
       result_t
       try_wait (void);
 
+      /**
+       * @brief Try to lock several units of the semaphore.
+       * @param [in] n Number of units to take from the count.
+       * @retval result::ok The calling process successfully
+       *  performed the semaphore lock operation.
+       * @retval EINVAL The number of units is not positive or
+       *  exceeds the maximum count value.
+       * @retval EWOULDBLOCK The count was lower than the requested units.
+       * @retval ENOTSUP More than one unit, with a port implementation.
+       * @retval ENOTRECOVERABLE Semaphore wait failed (extension to POSIX).
+       */
+      result_t
+      try_wait (count_t n);
+
       /**
        * @brief Timed wait to lock the semaphore.
        * @param [in] timeout Timeout to wait.
@@ -391,6 +433,24 @@ namespace os
       result_t
       timed_wait (clock::duration_t timeout);
 
+      /**
+       * @brief Timed wait to lock several units of the semaphore.
+       * @param [in] n Number of units to take from the count.
+       * @param [in] timeout Timeout to wait.
+       * @retval result::ok The calling process successfully
+       *  performed the semaphore lock operation.
+       * @retval EINVAL The number of units is not positive or
+       *  exceeds the maximum count value.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval ETIMEDOUT The semaphore could not be locked before
+       *  the specified timeout expired.
+       * @retval ENOTSUP More than one unit, with a port implementation.
+       * @retval ENOTRECOVERABLE Semaphore wait failed (extension to POSIX).
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_wait (count_t n, clock::duration_t timeout);
+
       /**
        * @brief Get the semaphore count value.
        * @par Parameters
@@ -452,7 +512,7 @@ namespace os
       internal_init_ (void);
 
       bool
-      internal_try_wait_ (void);
+      internal_try_wait_ (count_t n);
 
       /**
        * @endcond
@@ -473,8 +533,13 @@ namespace os
        * @cond ignore
        */
 
+      friend class wait_set;
+
 #if !defined(OS_USE_RTOS_PORT_SEMAPHORE)
       internal::waiting_threads_list list_;
+      // The wait sets request no units; kept apart, so that
+      // post() stops walking list_ when the units are exhausted.
+      internal::waiting_threads_list sets_list_;
       clock* clock_ = nullptr;
 #endif
 
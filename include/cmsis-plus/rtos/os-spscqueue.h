@@ -0,0 +1,473 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CMSIS_PLUS_RTOS_OS_SPSCQUEUE_H_
+#define CMSIS_PLUS_RTOS_OS_SPSCQUEUE_H_
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+
+#include <cmsis-plus/rtos/os-decls.h>
+#include <cmsis-plus/rtos/os-clocks.h>
+#include <cmsis-plus/rtos/os-semaphore.h>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+
+    // ========================================================================
+
+    /**
+     * @brief Template of a lock free **single producer, single
+     * consumer queue**.
+     * @headerfile os.h <cmsis-plus/rtos/os.h>
+     * @ingroup cmsis-plus-rtos-spscqueue
+     *
+     * @details
+     * A ring of `N` elements of type `T`, with two free running
+     * indices, the head, written only by the producer, and the tail,
+     * written only by the consumer. Both sides complete in a bounded
+     * number of steps, without critical sections, so the producer
+     * can be an interrupt handler and the consumer a thread.
+     *
+     * Waiting consumers are blocked on an internal binary semaphore,
+     * posted by the producer only when the queue goes from empty
+     * to non empty.
+     *
+     * There must be exactly one producer and one consumer; for
+     * more, use a message_queue.
+     */
+    template<typename T, std::size_t N>
+      class spsc_queue
+      {
+      public:
+
+        /**
+         * @brief Local type of elements.
+         */
+        using value_type = T;
+
+        /**
+         * @brief Type of the free running indices.
+         */
+        using index_t = std::size_t;
+
+        /**
+         * @brief Local constant based on template definition.
+         */
+        static constexpr std::size_t capacity = N;
+
+        static_assert(N >= 2 && (N & (N - 1)) == 0,
+            "spsc_queue capacity must be a power of 2");
+
+        /**
+         * @name Constructors & Destructor
+         * @{
+         */
+
+        /**
+         * @brief Construct a queue object instance.
+         * @par Parameters
+         *  None.
+         */
+        spsc_queue ();
+
+        /**
+         * @brief Construct a named queue object instance.
+         * @param [in] name Pointer to name.
+         */
+        spsc_queue (const char* name);
+
+        /**
+         * @cond ignore
+         */
+
+        // The rule of five.
+        spsc_queue (const spsc_queue&) = delete;
+        spsc_queue (spsc_queue&&) = delete;
+        spsc_queue&
+        operator= (const spsc_queue&) = delete;
+        spsc_queue&
+        operator= (spsc_queue&&) = delete;
+
+        /**
+         * @endcond
+         */
+
+        /**
+         * @brief Destruct the queue object instance.
+         */
+        ~spsc_queue () = default;
+
+        /**
+         * @}
+         */
+
+      public:
+
+        /**
+         * @name Public Member Functions
+         * @{
+         */
+
+        /**
+         * @brief Add an element to the queue, without blocking.
+         * @param [in] value Reference to the element to copy.
+         * @retval result::ok The element was added to the queue.
+         * @retval EWOULDBLOCK The queue was full.
+         */
+        result_t
+        push (const value_type& value);
+
+        /**
+         * @brief Remove the oldest element, without blocking.
+         * @param [out] value Reference where to copy the element.
+         * @retval result::ok The element was removed from the queue.
+         * @retval EWOULDBLOCK The queue was empty.
+         */
+        result_t
+        try_pop (value_type& value);
+
+        /**
+         * @brief Remove the oldest element, waiting if the queue is empty.
+         * @param [out] value Reference where to copy the element.
+         * @retval result::ok The element was removed from the queue.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        pop (value_type& value);
+
+        /**
+         * @brief Remove the oldest element, waiting if the queue is
+         * empty, with timeout.
+         * @param [out] value Reference where to copy the element.
+         * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+         * @retval result::ok The element was removed from the queue.
+         * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+         * @retval ETIMEDOUT No element arrived before the timeout.
+         * @retval EINTR The operation was interrupted.
+         */
+        result_t
+        timed_pop (value_type& value, clock::duration_t timeout);
+
+        /**
+         * @brief Get the number of elements in the queue.
+         * @par Parameters
+         *  None.
+         * @return The number of elements, a snapshot which may already
+         *  be outdated.
+         */
+        std::size_t
+        length (void) const;
+
+        /**
+         * @brief Check if the queue is empty.
+         * @par Parameters
+         *  None.
+         * @retval true The queue has no elements.
+         * @retval false The queue has at least one element.
+         */
+        bool
+        empty (void) const;
+
+        /**
+         * @brief Check if the queue is full.
+         * @par Parameters
+         *  None.
+         * @retval true The queue has no space for more elements.
+         * @retval false The queue has space for at least one element.
+         */
+        bool
+        full (void) const;
+
+        /**
+         * @brief Get the queue name.
+         * @par Parameters
+         *  None.
+         * @return A null terminated string.
+         */
+        const char*
+        name (void) const;
+
+        /**
+         * @}
+         */
+
+      protected:
+
+        /**
+         * @cond ignore
+         */
+
+        static constexpr index_t mask_ = N - 1;
+
+        // Each index on its own cache line, so that the producer and
+        // the consumer do not invalidate each other's line.
+        alignas(OS_INTEGER_RTOS_CACHE_LINE_SIZE_BYTES) index_t head_ = 0;
+        alignas(OS_INTEGER_RTOS_CACHE_LINE_SIZE_BYTES) index_t tail_ = 0;
+
+        alignas(OS_INTEGER_RTOS_CACHE_LINE_SIZE_BYTES) value_type arr_[N];
+
+        semaphore_binary sem_;
+
+        /**
+         * @endcond
+         */
+      };
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ===== Inline & template implementations ====================================
+
+namespace os
+{
+  namespace rtos
+  {
+
+    // ========================================================================
+
+    template<typename T, std::size_t N>
+      spsc_queue<T, N>::spsc_queue () :
+          sem_
+            { nullptr, 0 }
+      {
+        ;
+      }
+
+    template<typename T, std::size_t N>
+      spsc_queue<T, N>::spsc_queue (const char* name) :
+          sem_
+            { name, 0 }
+      {
+        ;
+      }
+
+    /**
+     * @details
+     * Only the producer may call this function.
+     *
+     * The element is copied into the ring and the head is published
+     * with release semantics, so the consumer never sees the
+     * index before the element.
+     *
+     * If the consumer had already taken all previous elements, it
+     * may be waiting, and the semaphore is posted. The full
+     * barrier between the store of the head and the load of the
+     * tail pairs with the one in pop(), so either the
+     * consumer sees the new element, or the producer sees the
+     * consumer ready to wait.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      result_t
+      spsc_queue<T, N>::push (const value_type& value)
+      {
+        index_t head = __atomic_load_n (&head_, __ATOMIC_RELAXED);
+        index_t tail = __atomic_load_n (&tail_, __ATOMIC_ACQUIRE);
+        if ((head - tail) == N)
+          {
+            return EWOULDBLOCK;
+          }
+
+        arr_[head & mask_] = value;
+        __atomic_store_n (&head_, head + 1, __ATOMIC_RELEASE);
+
+        __atomic_thread_fence (__ATOMIC_SEQ_CST);
+        if (__atomic_load_n (&tail_, __ATOMIC_RELAXED) == head)
+          {
+            // Empty to non empty; a redundant post, when the binary
+            // semaphore is already set, is ignored.
+            sem_.post ();
+          }
+
+        return result::ok;
+      }
+
+    /**
+     * @details
+     * Only the consumer may call this function.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      result_t
+      spsc_queue<T, N>::try_pop (value_type& value)
+      {
+        index_t tail = __atomic_load_n (&tail_, __ATOMIC_RELAXED);
+        index_t head = __atomic_load_n (&head_, __ATOMIC_ACQUIRE);
+        if (head == tail)
+          {
+            return EWOULDBLOCK;
+          }
+
+        value = arr_[tail & mask_];
+        __atomic_store_n (&tail_, tail + 1, __ATOMIC_RELEASE);
+
+        return result::ok;
+      }
+
+    /**
+     * @details
+     * Only the consumer may call this function.
+     *
+     * The semaphore may be set by a push() whose element was
+     * already taken by a previous try_pop(); after such a
+     * wakeup the queue is checked again.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      result_t
+      spsc_queue<T, N>::pop (value_type& value)
+      {
+        for (;;)
+          {
+            if (try_pop (value) == result::ok)
+              {
+                return result::ok;
+              }
+
+            // Pairs with the barrier in push().
+            __atomic_thread_fence (__ATOMIC_SEQ_CST);
+            if (!empty ())
+              {
+                continue;
+              }
+
+            result_t res = sem_.wait ();
+            if (res != result::ok)
+              {
+                return res;
+              }
+          }
+      }
+
+    /**
+     * @details
+     * Only the consumer may call this function.
+     *
+     * The timeout is measured with the system clock, from the
+     * moment of the call, and spurious wakeups do not extend it.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      result_t
+      spsc_queue<T, N>::timed_pop (value_type& value,
+                                   clock::duration_t timeout)
+      {
+        clock::timestamp_t deadline = sysclock.now () + timeout;
+        for (;;)
+          {
+            if (try_pop (value) == result::ok)
+              {
+                return result::ok;
+              }
+
+            // Pairs with the barrier in push().
+            __atomic_thread_fence (__ATOMIC_SEQ_CST);
+            if (!empty ())
+              {
+                continue;
+              }
+
+            clock::timestamp_t now = sysclock.now ();
+            if (now >= deadline)
+              {
+                return ETIMEDOUT;
+              }
+
+            result_t res = sem_.timed_wait (
+                static_cast<clock::duration_t> (deadline - now));
+            if (res != result::ok && res != ETIMEDOUT)
+              {
+                return res;
+              }
+          }
+      }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline std::size_t
+      spsc_queue<T, N>::length (void) const
+      {
+        index_t tail = __atomic_load_n (&tail_, __ATOMIC_ACQUIRE);
+        index_t head = __atomic_load_n (&head_, __ATOMIC_ACQUIRE);
+        return static_cast<std::size_t> (head - tail);
+      }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline bool
+      spsc_queue<T, N>::empty (void) const
+      {
+        return (length () == 0);
+      }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline bool
+      spsc_queue<T, N>::full (void) const
+      {
+        return (length () == N);
+      }
+
+    /**
+     * @details
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    template<typename T, std::size_t N>
+      inline const char*
+      spsc_queue<T, N>::name (void) const
+      {
+        return sem_.name ();
+      }
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ----------------------------------------------------------------------------
+
+#endif /* __cplusplus */
+
+#endif /* CMSIS_PLUS_RTOS_OS_SPSCQUEUE_H_ */
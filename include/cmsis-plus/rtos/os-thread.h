@@ -840,6 +840,24 @@ namespace os
          */
         priority_t th_priority = priority::normal;
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) || defined(__DOXYGEN__)
+
+        /**
+         * @brief Thread time slice, in system clock ticks.
+         * @details
+         * When the time slice expires, the running thread is moved
+         * behind the ready threads with the same priority.
+         *
+         * If 0, the thread is not subject to time slicing.
+         *
+         * Available only when `OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN`
+         * is defined.
+         */
+        clock::duration_t th_quantum_ticks =
+            OS_INTEGER_RTOS_THREAD_QUANTUM_TICKS;
+
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
         // Add more attributes here.
 
         /**
@@ -1303,6 +1321,9 @@ namespace os
       friend int*
       this_thread::__errno (void);
 
+      friend void
+      this_thread::yield (void);
+
       friend void
       scheduler::internal_link_node (internal::waiting_threads_list& list,
                                      internal::waiting_thread_node& node);
@@ -1325,6 +1346,14 @@ namespace os
       friend void
       scheduler::internal_switch_threads (void);
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) \
+  && !defined(OS_USE_RTOS_PORT_SCHEDULER)
+
+      friend void
+      scheduler::internal_check_quantum (void);
+
+#endif
+
       friend void
       port::scheduler::reschedule (void);
 
@@ -1346,6 +1375,8 @@ namespace os
       friend class clock;
       friend class condition_variable;
       friend class mutex;
+      friend class rwlock;
+      friend class wait_set;
 
       /**
        * @endcond
@@ -1389,6 +1420,20 @@ namespace os
       void
       internal_suspend_ (void);
 
+#if !defined(OS_USE_RTOS_PORT_SCHEDULER)
+
+      /**
+       * @brief Link this thread to the ready list, if not already there.
+       * @par Parameters
+       *  None.
+       * @par Returns
+       *  Nothing.
+       */
+      void
+      internal_link_ready_ (void);
+
+#endif /* !defined(OS_USE_RTOS_PORT_SCHEDULER) */
+
       /**
        * @brief Terminate thread by itself.
        * @param [in] exit_ptr Pointer to object to return (optional).
@@ -1531,6 +1576,15 @@ namespace os
       void
       internal_check_stack_ (void);
 
+      /**
+       * @brief Compute the priority inherited via mutexes and rwlocks.
+       * @par Parameters
+       *  None.
+       * @return The highest boosted priority, or `priority::none`.
+       */
+      priority_t
+      internal_inherited_priority_ (void);
+
       /**
        * @endcond
        */
@@ -1578,6 +1632,10 @@ namespace os
       // List of mutexes that this thread owns.
       utils::double_list mutexes_;
 
+      // List of read-write locks that this thread holds for writing
+      // and that boosted its priority.
+      utils::double_list rwlocks_;
+
     protected:
 
       // Thread waiting to join.
@@ -1589,6 +1647,9 @@ namespace os
       // Pointer to timeout node (stored on stack)
       internal::timeout_thread_node* clock_node_ = nullptr;
 
+      // Pointer to the wait set, when waiting on multiple objects
+      wait_set* waiting_set_ = nullptr;
+
       /**
        * @brief Pointer to clock to be used for timeouts.
        */
@@ -1646,6 +1707,16 @@ namespace os
 
 #endif /* defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CONTEXT_SWITCHES) */
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+
+      // The time slice, in sysclock ticks; 0 disables time slicing.
+      clock::duration_t quantum_ticks_ = 0;
+      // The ticks left from the current time slice, decremented
+      // by the system clock interrupt.
+      clock::duration_t volatile quantum_left_ = 0;
+
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
       // Add other internal data
 
       // Implementation
@@ -2372,7 +2443,23 @@ namespace os
           internal::waiting_thread_node& crt_node = ready_node_;
           if (crt_node.next () == nullptr)
             {
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+              if ((quantum_ticks_ != 0) && (quantum_left_ != 0))
+                {
+                  // Preempted before the time slice expired,
+                  // keep the place in front of the peers.
+                  rtos::scheduler::ready_threads_list_.link_head (crt_node);
+                }
+              else
+                {
+                  // The time slice expired (or the thread yielded),
+                  // move it behind the peers, with a new slice.
+                  quantum_left_ = quantum_ticks_;
+                  rtos::scheduler::ready_threads_list_.link (crt_node);
+                }
+#else
               rtos::scheduler::ready_threads_list_.link (crt_node);
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
               // Ready state set in above link().
             }
 
@@ -2380,6 +2467,14 @@ namespace os
           // did not underflow the stack.
           assert (stack ().check_bottom_magic ());
         }
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+      else
+        {
+          // The thread is suspending, it will start with a new
+          // time slice when resumed.
+          quantum_left_ = quantum_ticks_;
+        }
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
     }
 
     /**
@@ -45,6 +45,25 @@ namespace os
 {
   namespace rtos
   {
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+    namespace timer_daemon
+    {
+      /**
+       * @cond ignore
+       */
+
+      void*
+      internal_run (void* args);
+
+      /**
+       * @endcond
+       */
+    } /* namespace timer_daemon */
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
     // ========================================================================
 
 #pragma GCC diagnostic push
@@ -196,6 +215,30 @@ namespace os
          */
         type_t tm_type = run::once;
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+
+        /**
+         * @brief Run the timer function in the clock interrupt.
+         * @details
+         * By default the function runs on the timer daemon thread;
+         * use it only for very short functions.
+         */
+        bool tm_in_isr = false;
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+
+        /**
+         * @brief Timer tolerance, in clock units.
+         * @details
+         * The timer may fire up to this number of clock units
+         * later, together with other deadlines; see `clock::coalesce()`.
+         */
+        clock::duration_t tm_slack = 0;
+
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
+
         // Add more attributes.
 
         /**
@@ -367,6 +410,12 @@ namespace os
 
       friend class internal::timer_node;
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+      friend void*
+      timer_daemon::internal_run (void* args);
+#endif
+
       /**
        * @endcond
        */
@@ -391,6 +440,16 @@ namespace os
       void
       internal_interrupt_service_routine (void);
 
+      void
+      internal_unlink_ (void);
+
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+
+      void
+      internal_dispatch_ (void);
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
 #endif
 
       /**
@@ -420,6 +479,10 @@ namespace os
       internal::timer_node timer_node_
         { 0, *this };
       clock::duration_t period_ = 0;
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+      clock::timestamp_t nominal_ = 0;
+      clock::duration_t slack_ = 0;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
 #endif
 
 #if defined(OS_USE_RTOS_PORT_TIMER)
@@ -430,6 +493,12 @@ namespace os
       type_t type_ = run::once;
       state_t state_ = state::undefined;
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+      bool in_isr_ = false;
+      // True while the node is in the timer daemon pending list.
+      bool pending_ = false;
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
       // Add more internal data.
 
       /**
@@ -444,6 +513,82 @@ namespace os
 
 #pragma GCC diagnostic pop
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+    /**
+     * @brief Timer daemon.
+     * @ingroup cmsis-plus-rtos-timer
+     * @details
+     * Thread running the timer functions, outside the clock interrupt.
+     */
+    namespace timer_daemon
+    {
+      /**
+       * @cond ignore
+       */
+
+      /**
+       * @brief Thread flag used to notify the daemon.
+       */
+      constexpr flags::mask_t flag = 1;
+
+      extern internal::timer_nodes_list pending_list_;
+      extern rtos::thread* thread_;
+
+      /**
+       * @endcond
+       */
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON)
+
+      /**
+       * @brief Timer daemon statistics.
+       */
+      namespace statistics
+      {
+        /**
+         * @brief Get the number of timers waiting for the daemon.
+         * @return Integer with the current queue depth.
+         */
+        std::size_t
+        queue_depth (void);
+
+        /**
+         * @brief Get the largest number of timers waiting for the daemon.
+         * @return Integer with the maximum queue depth.
+         */
+        std::size_t
+        max_queue_depth (void);
+
+        /**
+         * @brief Get the longest delay between a timer expiry and
+         * the call of its function.
+         * @return Integer with the number of timer clock ticks.
+         */
+        clock::duration_t
+        max_dispatch_delay (void);
+
+        /**
+         * @cond ignore
+         */
+
+        extern std::size_t queue_depth_;
+        extern std::size_t max_queue_depth_;
+        extern clock::duration_t max_dispatch_delay_;
+
+        /**
+         * @endcond
+         */
+
+      } /* namespace statistics */
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON) */
+
+    } /* namespace timer_daemon */
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
   } /* namespace rtos */
 } /* namespace os */
 
@@ -495,6 +640,64 @@ namespace os
       return this == &rhs;
     }
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER) \
+    && defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON)
+
+    namespace timer_daemon
+    {
+      namespace statistics
+      {
+        /**
+         * @details
+         * The number of expired timers linked to the daemon
+         * list and not yet dispatched.
+         *
+         * @note This function is available only when
+         * @ref OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON
+         * is defined.
+         */
+        inline std::size_t
+        queue_depth (void)
+        {
+          return queue_depth_;
+        }
+
+        /**
+         * @details
+         * A value close to the number of timers shows that the
+         * daemon priority is too low.
+         *
+         * @note This function is available only when
+         * @ref OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON
+         * is defined.
+         */
+        inline std::size_t
+        max_queue_depth (void)
+        {
+          return max_queue_depth_;
+        }
+
+        /**
+         * @details
+         * The delay is measured when the daemon calls the timer
+         * function, from the timer time stamp.
+         *
+         * @note This function is available only when
+         * @ref OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON
+         * is defined.
+         */
+        inline clock::duration_t
+        max_dispatch_delay (void)
+        {
+          return max_dispatch_delay_;
+        }
+
+      } /* namespace statistics */
+    } /* namespace timer_daemon */
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON) */
+
   } /* namespace rtos */
 } /* namespace os */
 
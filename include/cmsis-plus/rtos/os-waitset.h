@@ -0,0 +1,361 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef CMSIS_PLUS_RTOS_OS_WAITSET_H_
+#define CMSIS_PLUS_RTOS_OS_WAITSET_H_
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+
+#include <cmsis-plus/rtos/os-decls.h>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+
+    // ========================================================================
+
+    /**
+     * @brief Set of synchronisation objects to **wait on at once**.
+     * @headerfile os.h <cmsis-plus/rtos/os.h>
+     * @ingroup cmsis-plus-rtos-waitset
+     */
+    class wait_set : public internal::object_named
+    {
+    public:
+
+      /**
+       * @brief Type of variables holding object indices.
+       */
+      using index_t = std::size_t;
+
+      /**
+       * @brief Constant with the maximum number of objects in a set.
+       */
+      static constexpr index_t max_objects =
+      OS_INTEGER_RTOS_WAIT_SET_MAX_OBJECTS;
+
+      // ======================================================================
+
+      /**
+       * @name Constructors & Destructor
+       * @{
+       */
+
+      /**
+       * @brief Construct a wait set object instance.
+       * @par Parameters
+       *  None.
+       */
+      wait_set ();
+
+      /**
+       * @brief Construct a named wait set object instance.
+       * @param [in] name Pointer to name.
+       */
+      wait_set (const char* name);
+
+      /**
+       * @cond ignore
+       */
+
+      // The rule of five.
+      wait_set (const wait_set&) = delete;
+      wait_set (wait_set&&) = delete;
+      wait_set&
+      operator= (const wait_set&) = delete;
+      wait_set&
+      operator= (wait_set&&) = delete;
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @brief Destruct the wait set object instance.
+       */
+      ~wait_set ();
+
+      /**
+       * @}
+       */
+
+    public:
+
+      /**
+       * @name Public Member Functions
+       * @{
+       */
+
+      /**
+       * @brief Add a semaphore, ready when it can be decremented.
+       * @param [in] sem Reference to the semaphore.
+       * @retval result::ok The semaphore was added.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is being waited on.
+       * @retval EAGAIN The set is full.
+       */
+      result_t
+      add (semaphore& sem);
+
+      /**
+       * @brief Add a message queue, ready when it has messages.
+       * @param [in] mq Reference to the message queue.
+       * @retval result::ok The message queue was added.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is being waited on.
+       * @retval EAGAIN The set is full.
+       */
+      result_t
+      add (message_queue& mq);
+
+      /**
+       * @brief Add a memory pool, ready when it has free blocks.
+       * @param [in] mp Reference to the memory pool.
+       * @retval result::ok The memory pool was added.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is being waited on.
+       * @retval EAGAIN The set is full.
+       */
+      result_t
+      add (memory_pool& mp);
+
+      /**
+       * @brief Add an event flags object, ready when the expected
+       *  flags are raised.
+       * @param [in] evf Reference to the event flags.
+       * @param [in] mask The expected flags (OR-ed bit-mask);
+       *  if `flags::any`, any flag raised will do it.
+       * @param [in] mode Mode bits to select if either all or any flags
+       *  are expected; `flags::mode::clear` is ignored.
+       * @retval result::ok The event flags object was added.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is being waited on.
+       * @retval EAGAIN The set is full.
+       */
+      result_t
+      add (event_flags& evf, flags::mask_t mask, flags::mode_t mode =
+               flags::mode::all);
+
+      /**
+       * @brief Add the flags of the waiting thread, ready when the
+       *  expected flags are raised.
+       * @param [in] mask The expected flags (OR-ed bit-mask);
+       *  if `flags::any`, any flag raised will do it.
+       * @param [in] mode Mode bits to select if either all or any flags
+       *  are expected; `flags::mode::clear` is ignored.
+       * @retval result::ok The thread flags were added.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is being waited on.
+       * @retval EAGAIN The set is full.
+       */
+      result_t
+      add_thread_flags (flags::mask_t mask, flags::mode_t mode =
+                            flags::mode::all);
+
+      /**
+       * @brief Remove all objects from the set.
+       * @par Parameters
+       *  None.
+       * @retval result::ok The set was cleared.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is being waited on.
+       */
+      result_t
+      clear (void);
+
+      /**
+       * @brief Get the number of objects in the set.
+       * @par Parameters
+       *  None.
+       * @return The number of objects.
+       */
+      index_t
+      size (void) const;
+
+      /**
+       * @brief Wait until one of the objects is ready.
+       * @param [out] index Pointer where to store the index of the
+       *  ready object; may be `nullptr`.
+       * @retval result::ok One of the objects is ready.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is already waited on.
+       * @retval EINVAL The set is empty.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      wait_any (index_t* index = nullptr);
+
+      /**
+       * @brief Check if one of the objects is ready.
+       * @param [out] index Pointer where to store the index of the
+       *  ready object; may be `nullptr`.
+       * @retval result::ok One of the objects is ready.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines.
+       * @retval EINVAL The set is empty.
+       * @retval EWOULDBLOCK No object is ready.
+       */
+      result_t
+      try_wait_any (index_t* index = nullptr);
+
+      /**
+       * @brief Timed wait until one of the objects is ready.
+       * @param [in] timeout Timeout to wait, in clock units (ticks or seconds).
+       * @param [out] index Pointer where to store the index of the
+       *  ready object; may be `nullptr`.
+       * @retval result::ok One of the objects is ready.
+       * @retval EPERM Cannot be invoked from an Interrupt Service Routines,
+       *  or the set is already waited on.
+       * @retval EINVAL The set is empty.
+       * @retval ETIMEDOUT No object became ready before the timeout passed.
+       * @retval EINTR The operation was interrupted.
+       */
+      result_t
+      timed_wait_any (clock::duration_t timeout, index_t* index = nullptr);
+
+      /**
+       * @}
+       */
+
+    protected:
+
+      friend class thread;
+
+      /**
+       * @name Private Member Functions
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      result_t
+      internal_add_ (void* object, uint8_t kind, flags::mask_t mask,
+                     flags::mode_t mode);
+
+      bool
+      internal_ready_ (index_t* index);
+
+      void
+      internal_link_ (thread& th);
+
+      void
+      internal_unlink_ (void);
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @}
+       */
+
+    protected:
+
+      /**
+       * @name Private Member Variables
+       * @{
+       */
+
+      /**
+       * @cond ignore
+       */
+
+      struct kind
+      {
+        enum
+          : uint8_t
+            {
+              semaphore = 1,
+              message_queue,
+              memory_pool,
+              event_flags,
+              thread_flags
+        };
+      };
+
+      struct entry
+      {
+        void* object;
+        uint8_t kind;
+        // Linked into the object waiting list while waiting.
+        internal::waiting_flags_node node;
+      };
+
+      entry entries_[max_objects];
+      index_t count_ = 0;
+
+      // The thread waiting on the set, if any.
+      thread* volatile waiter_ = nullptr;
+
+      /**
+       * @endcond
+       */
+
+      // Add more internal data.
+
+      /**
+       * @}
+       */
+
+    };
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ===== Inline & template implementations ====================================
+
+namespace os
+{
+  namespace rtos
+  {
+
+    /**
+     * @details
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    inline wait_set::index_t
+    wait_set::size (void) const
+    {
+      return count_;
+    }
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ----------------------------------------------------------------------------
+
+#endif /* __cplusplus */
+
+#endif /* CMSIS_PLUS_RTOS_OS_WAITSET_H_ */
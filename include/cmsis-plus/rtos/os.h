@@ -98,10 +98,15 @@
 #include <cmsis-plus/rtos/os-timer.h>
 #include <cmsis-plus/rtos/os-mutex.h>
 #include <cmsis-plus/rtos/os-condvar.h>
+#include <cmsis-plus/rtos/os-rwlock.h>
 #include <cmsis-plus/rtos/os-semaphore.h>
 #include <cmsis-plus/rtos/os-mempool.h>
 #include <cmsis-plus/rtos/os-mqueue.h>
+#include <cmsis-plus/rtos/os-spscqueue.h>
+#include <cmsis-plus/rtos/os-mpmcqueue.h>
 #include <cmsis-plus/rtos/os-evflags.h>
+#include <cmsis-plus/rtos/os-waitset.h>
+#include <cmsis-plus/rtos/os-evtrace.h>
 
 #include <cmsis-plus/rtos/os-hooks.h>
 
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus)
+#
+# Decode a binary dump of the µOS++ scheduler events trace ring
+# (`os::rtos::evtrace::ring_`, enabled by `OS_INCLUDE_RTOS_EVTRACE`)
+# into a text timeline, or into a Chrome Trace Event JSON file,
+# to be viewed in `chrome://tracing` or in the Perfetto UI.
+#
+# Dump the ring with the debugger, for example:
+#
+#   (gdb) dump binary value trace.bin os::rtos::evtrace::ring_
+#
+# and decode it with:
+#
+#   python3 evtrace-decode.py trace.bin -n 0x20001230=main -n 0x20002000=idle
+#
+# or convert it with:
+#
+#   python3 evtrace-decode.py trace.bin --json trace.json -n 0x20001230=main
+#
+
+import argparse
+import json
+import struct
+import sys
+
+# Must match `os-evtrace.h`.
+MAGIC = 0x52544f45
+VERSION = 1
+HEADER = struct.Struct('<IHHIIII')
+RECORD = struct.Struct('<IIII')
+
+EVENTS = {
+    1: 'switch',
+    2: 'resume',
+    3: 'wait',
+    4: 'wait-end',
+    5: 'tick',
+    6: 'isr-enter',
+    7: 'isr-exit',
+    8: 'timer',
+}
+
+USER_EVENT = 128
+
+
+def parse_name(text):
+    addr, _, name = text.partition('=')
+    return int(addr, 0), name
+
+
+def read_records(data):
+    (magic, version, record_size, count, frequency_hz, head,
+     _reserved) = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        sys.exit('not an evtrace dump (magic 0x%08x)' % magic)
+    if version != VERSION or record_size != RECORD.size:
+        sys.exit('unsupported evtrace version %u, record size %u'
+                 % (version, record_size))
+
+    if len(data) < HEADER.size + count * record_size:
+        sys.exit('truncated dump, %u records expected' % count)
+
+    # Oldest first; when the ring wrapped, the oldest is at head.
+    if head <= count:
+        indices = range(head)
+    else:
+        indices = [(head + i) % count for i in range(count)]
+
+    records = [RECORD.unpack_from(data, HEADER.size + i * record_size)
+               for i in indices]
+    return records, frequency_hz, head
+
+
+def unwrap(records):
+    # Extend the 32-bit timestamps, allowing small negative steps,
+    # for records interrupted before taking their timestamps.
+    # The ring order is kept, like in `os::rtos::evtrace::write_json()`.
+    result = []
+    total = None
+    previous = None
+    for ts, event, thread, obj in records:
+        if total is None:
+            total = ts
+        else:
+            delta = (ts - previous) & 0xffffffff
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            total += delta
+        previous = ts
+        result.append((total, event, thread, obj))
+    return result
+
+
+def to_json(timeline, frequency_hz, names, first):
+    # Same layout and events as `os::rtos::evtrace::write_json()`: one
+    # track per thread, plus track 0 for interrupts, ticks and timers.
+    # Only the thread names differ, here they come from the records
+    # and the command line.
+    isr_track = 0
+    events = [
+        {'ph': 'M', 'pid': 1, 'tid': isr_track, 'name': 'process_name',
+         'args': {'name': 'µOS++'}},
+        {'ph': 'M', 'pid': 1, 'tid': isr_track, 'name': 'thread_name',
+         'args': {'name': 'interrupts'}},
+    ]
+
+    threads = set()
+    for _, event, thread, obj in timeline:
+        if thread != 0:
+            threads.add(thread)
+        if event in (1, 2) and obj != 0:
+            threads.add(obj)
+    for addr in sorted(threads):
+        events.append({'ph': 'M', 'pid': 1, 'tid': addr,
+                       'name': 'thread_name',
+                       'args': {'name': names.get(addr, '0x%08x' % addr)}})
+
+    start = timeline[0][0] if timeline else 0
+    scale = 1e6 / frequency_hz if frequency_hz else 1.0
+
+    flows = {}
+    running = 0
+    isr_depth = 0
+    # The flow ids are the record sequence numbers, as written.
+    for seq, (ts, event, thread, obj) in enumerate(timeline, first):
+        common = {'pid': 1, 'ts': round((ts - start) * scale, 3)}
+
+        def add(ph, tid, **kwargs):
+            item = dict(common, ph=ph, tid=tid)
+            item.update(kwargs)
+            events.append(item)
+
+        def instant(tid, name, **kwargs):
+            add('i', tid, name=name, s='t', **kwargs)
+
+        if event == 1:
+            if running != 0 and running == obj:
+                add('E', running)
+            add('B', thread, name='running')
+            running = thread
+            if thread in flows:
+                add('f', thread, name='wake', cat='wake',
+                    id=flows.pop(thread), bp='e')
+        elif event == 2:
+            add('s', isr_track if isr_depth else thread, name='wake',
+                cat='wake', id=seq)
+            flows[obj] = seq
+        elif event == 3:
+            instant(thread, 'wait', args={'object': '0x%08x' % obj})
+        elif event == 4:
+            instant(thread, 'wait-end')
+        elif event == 5:
+            instant(isr_track, 'tick', args={'object': '0x%08x' % obj})
+        elif event == 6:
+            add('B', isr_track, name='irq', args={'irq': obj})
+            isr_depth += 1
+        elif event == 7:
+            if isr_depth:
+                add('E', isr_track)
+                isr_depth -= 1
+        elif event == 8:
+            instant(isr_track, 'timer', args={'object': '0x%08x' % obj})
+        elif event >= USER_EVENT:
+            instant(thread, 'user-%u' % (event - USER_EVENT),
+                    args={'object': '0x%08x' % obj})
+        else:
+            # Not known to this version.
+            instant(thread, 'event-%u' % event,
+                    args={'object': '0x%08x' % obj})
+
+    return {'displayTimeUnit': 'ns', 'traceEvents': events}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode a µOS++ scheduler events trace dump.')
+    parser.add_argument('dump', help='binary dump of the trace ring')
+    parser.add_argument('-n', '--name', action='append', default=[],
+                        type=parse_name, metavar='ADDR=NAME',
+                        help='name for a thread or object address')
+    parser.add_argument('--cycles', action='store_true',
+                        help='show clock cycles instead of microseconds')
+    parser.add_argument('--json', metavar='FILE',
+                        help='write a Chrome Trace Event JSON file instead')
+    args = parser.parse_args()
+
+    with open(args.dump, 'rb') as f:
+        data = f.read()
+
+    records, frequency_hz, head = read_records(data)
+    names = dict(args.name)
+
+    def name(addr):
+        if addr == 0:
+            return '-'
+        return names.get(addr, '0x%08x' % addr)
+
+    timeline = unwrap(records)
+    if args.json:
+        with open(args.json, 'w') as f:
+            first = head - len(timeline)
+            json.dump(to_json(timeline, frequency_hz, names, first), f,
+                      indent=0)
+        return
+
+    if not timeline:
+        print('no records')
+        return
+
+    print('%u records (%u written), clock %u Hz'
+          % (len(timeline), head, frequency_hz))
+
+    start = timeline[0][0]
+    for ts, event, thread, obj in timeline:
+        if args.cycles or frequency_hz == 0:
+            when = '%12u' % (ts - start)
+        else:
+            when = '%12.3f' % ((ts - start) * 1e6 / frequency_hz)
+
+        if event >= USER_EVENT:
+            what = 'user-%u' % (event - USER_EVENT)
+        else:
+            what = EVENTS.get(event, 'event-%u' % event)
+
+        if event == 1:
+            detail = '%s -> %s' % (name(obj), name(thread))
+        elif event in (6, 7):
+            detail = '%s irq %u' % (name(thread), obj)
+        else:
+            detail = '%s %s' % (name(thread), name(obj))
+
+        print('%s  %-10s %s' % (when, what, detail))
+
+
+if __name__ == '__main__':
+    main()
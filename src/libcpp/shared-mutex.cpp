@@ -0,0 +1,132 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cerrno>
+#include <cmsis-plus/estd/shared_mutex>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace estd
+  {
+    // ========================================================================
+
+    using namespace os;
+
+    void
+    shared_mutex::lock ()
+    {
+      rtos::result_t res;
+      res = nr_.write_lock ();
+      if (res != rtos::result::ok)
+        {
+          __throw_cmsis_error (static_cast<int> (res),
+                               "shared_mutex lock failed");
+        }
+    }
+
+    bool
+    shared_mutex::try_lock ()
+    {
+      rtos::result_t res;
+      res = nr_.try_write_lock ();
+      if (res == rtos::result::ok)
+        {
+          return true;
+        }
+      else if (res == EWOULDBLOCK)
+        {
+          return false;
+        }
+
+      __throw_cmsis_error (static_cast<int> (res),
+                           "shared_mutex try_lock failed");
+      // return false;
+    }
+
+    void
+    shared_mutex::unlock ()
+    {
+      rtos::result_t res;
+      res = nr_.unlock ();
+      if (res != rtos::result::ok)
+        {
+          __throw_cmsis_error (static_cast<int> (res),
+                               "shared_mutex unlock failed");
+        }
+    }
+
+    void
+    shared_mutex::lock_shared ()
+    {
+      rtos::result_t res;
+      res = nr_.read_lock ();
+      if (res != rtos::result::ok)
+        {
+          __throw_cmsis_error (static_cast<int> (res),
+                               "shared_mutex lock_shared failed");
+        }
+    }
+
+    bool
+    shared_mutex::try_lock_shared ()
+    {
+      rtos::result_t res;
+      res = nr_.try_read_lock ();
+      if (res == rtos::result::ok)
+        {
+          return true;
+        }
+      else if (res == EWOULDBLOCK)
+        {
+          return false;
+        }
+
+      __throw_cmsis_error (static_cast<int> (res),
+                           "shared_mutex try_lock_shared failed");
+      // return false;
+    }
+
+    void
+    shared_mutex::unlock_shared ()
+    {
+      rtos::result_t res;
+      res = nr_.unlock ();
+      if (res != rtos::result::ok)
+        {
+          __throw_cmsis_error (static_cast<int> (res),
+                               "shared_mutex unlock_shared failed");
+        }
+    }
+
+  // --------------------------------------------------------------------------
+
+  } /* namespace estd */
+} /* namespace os */
+
+// ----------------------------------------------------------------------------
@@ -47,6 +47,8 @@ namespace os
 
       // ======================================================================
 
+#if !defined(OS_USE_RTOS_READY_LIST_BITMAP)
+
       void
       ready_threads_list::link (waiting_thread_node& node)
       {
@@ -107,6 +109,45 @@ namespace os
         node.thread_->state_ = thread::state::ready;
       }
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+
+      /**
+       * @details
+       * Used to put back a preempted thread that did not exhaust
+       * its time slice, so that it resumes before its peers.
+       */
+      void
+      ready_threads_list::link_head (waiting_thread_node& node)
+      {
+        if (head_.prev () == nullptr)
+          {
+            // If this is the first time, initialise the list to empty.
+            clear ();
+          }
+
+        thread::priority_t prio = node.thread_->priority ();
+
+#if defined(OS_TRACE_RTOS_LISTS)
+        trace::printf ("ready %s() +%u\n", __func__, prio);
+#endif
+
+        // Skip all nodes with higher priority.
+        waiting_thread_node* after =
+            static_cast<waiting_thread_node*> (const_cast<utils::static_double_list_links *> (&head_));
+        while ((after->next () != &head_)
+            && (static_cast<waiting_thread_node*> (after->next ())->thread_->priority ()
+                > prio))
+          {
+            after = static_cast<waiting_thread_node*> (after->next ());
+          }
+
+        insert_after (node, after);
+
+        node.thread_->state_ = thread::state::ready;
+      }
+
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
       /**
        * @details
        * Must be called in a critical section.
@@ -134,6 +175,174 @@ namespace os
         return th;
       }
 
+#else
+
+      /**
+       * @class ready_threads_list
+       * @details
+       * When `OS_USE_RTOS_READY_LIST_BITMAP` is defined, the ready
+       * threads are kept in separate FIFO lists, one for each priority
+       * level, and a two-level bitmap tells which lists are not empty.
+       *
+       * Linking a node, unlinking the top node and moving a node
+       * after a priority change are all constant time, regardless
+       * of the number of ready threads, at the expense of a
+       * larger static footprint (a list head for each priority).
+       *
+       * To keep the bitmap accurate, nodes must be removed from the
+       * list only via `ready_threads_list::unlink()`.
+       */
+
+      static_assert(sizeof(thread::priority_t) == 1,
+          "The ready list bitmap is sized for 8-bit priorities.");
+
+      void
+      ready_threads_list::priority_list::link_tail (waiting_thread_node& node)
+      {
+        if (uninitialized ())
+          {
+            // If this is the first time, initialise the list to empty.
+            clear ();
+          }
+
+        insert_after (node,
+                      const_cast<utils::static_double_list_links *> (tail ()));
+      }
+
+      void
+      ready_threads_list::priority_list::link_front (waiting_thread_node& node)
+      {
+        if (uninitialized ())
+          {
+            // If this is the first time, initialise the list to empty.
+            clear ();
+          }
+
+        insert_after (node, &head_);
+      }
+
+      void
+      ready_threads_list::link (waiting_thread_node& node)
+      {
+        thread::priority_t prio = node.thread_->priority ();
+
+#if defined(OS_TRACE_RTOS_LISTS)
+        trace::printf ("ready %s() +%u\n", __func__, prio);
+#endif
+
+        // Insert at the end of the list with the same priority.
+        lists_[prio].link_tail (node);
+
+        map_[prio / bits_per_word] |= (1u << (prio % bits_per_word));
+        summary_ |= (1u << (prio / bits_per_word));
+
+        node.thread_->state_ = thread::state::ready;
+      }
+
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+
+      void
+      ready_threads_list::link_head (waiting_thread_node& node)
+      {
+        thread::priority_t prio = node.thread_->priority ();
+
+#if defined(OS_TRACE_RTOS_LISTS)
+        trace::printf ("ready %s() +%u\n", __func__, prio);
+#endif
+
+        // Insert at the beginning of the list with the same priority.
+        lists_[prio].link_front (node);
+
+        map_[prio / bits_per_word] |= (1u << (prio % bits_per_word));
+        summary_ |= (1u << (prio / bits_per_word));
+
+        node.thread_->state_ = thread::state::ready;
+      }
+
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
+      /**
+       * @details
+       * Must be called in a critical section.
+       */
+      thread*
+      ready_threads_list::unlink_head (void)
+      {
+        assert (!empty ());
+
+        waiting_thread_node* node =
+            const_cast<waiting_thread_node*> (head ());
+        thread* th = node->thread_;
+
+#if defined(OS_TRACE_RTOS_LISTS)
+        trace::printf ("ready %s() %p %s\n", __func__, th, th->name ());
+#endif
+
+        unlink (*node);
+
+        assert (th != nullptr);
+
+        // Unlinking is immediately followed by a context switch,
+        // so in order to guarantee that the thread is marked as
+        // running, it is saver to do it here.
+
+        th->state_ = thread::state::running;
+        return th;
+      }
+
+      /**
+       * @details
+       * If the node was the last one in its priority list, the
+       * neighbour left behind is the list head, pointing to itself;
+       * its address identifies the priority level, so the
+       * corresponding bit can be cleared without knowing
+       * the thread priority at the time it was linked.
+       *
+       * Nodes linked to other lists (like the terminated threads
+       * list) are also accepted, and simply unlinked.
+       *
+       * Must be called in a critical section.
+       */
+      void
+      ready_threads_list::unlink (waiting_thread_node& node)
+      {
+        utils::static_double_list_links* next = node.next ();
+        if (next == nullptr)
+          {
+            // Not linked.
+            return;
+          }
+
+        node.unlink ();
+
+        if (next->next () != next)
+          {
+            // There are more nodes in the list.
+            return;
+          }
+
+        std::uintptr_t first =
+            reinterpret_cast<std::uintptr_t> (lists_[0].head_links ());
+        std::uintptr_t addr = reinterpret_cast<std::uintptr_t> (next);
+        if (addr < first || addr >= first + sizeof(lists_))
+          {
+            // Not one of the priority lists.
+            return;
+          }
+
+        std::size_t level = (addr - first) / sizeof(priority_list);
+        assert (lists_[level].head_links () == next);
+
+        std::size_t word = level / bits_per_word;
+        map_[word] &= ~(1u << (level % bits_per_word));
+        if (map_[word] == 0)
+          {
+            summary_ &= ~(1u << word);
+          }
+      }
+
+#endif /* !defined(OS_USE_RTOS_READY_LIST_BITMAP) */
+
       // ======================================================================
 
       /**
@@ -279,6 +488,89 @@ namespace os
           ;
       }
 
+      /**
+       * @details
+       * Walk the list in priority order and, for each waiting thread,
+       * check its expected flags against the raised flags; if the
+       * condition is satisfied, consume the flags (for `flags::mode::clear`)
+       * and move the node to a local list, all in a single critical
+       * section, such that higher priority threads get the flags first
+       * and threads which would only go back to sleep are not
+       * awakened at all.
+       *
+       * The selected threads are then resumed outside the critical section.
+       */
+      void
+      waiting_threads_list::resume_raised (event_flags& flags)
+      {
+        waiting_threads_list satisfied;
+          {
+            // ----- Enter critical section -----------------------------------
+            interrupts::critical_section ics;
+
+            utils::static_double_list_links* it = head_.next ();
+            while (it != &head_)
+              {
+                // Save the next, the node may be unlinked below.
+                utils::static_double_list_links* next = it->next ();
+
+                waiting_flags_node* node =
+                    static_cast<waiting_flags_node*> (it);
+                if (flags.check_raised (node->mask_, &node->raised_,
+                                        node->mode_))
+                  {
+                    node->satisfied_ = true;
+                    node->unlink ();
+                    satisfied.link (*node);
+
+                    if (flags.mask () == 0)
+                      {
+                        // Nothing left to be consumed.
+                        break;
+                      }
+                  }
+                it = next;
+              }
+            // ----- Exit critical section ------------------------------------
+          }
+
+        satisfied.resume_all ();
+      }
+
+      void
+      waiting_threads_list::resume_counted (std::size_t count)
+      {
+        waiting_threads_list satisfied;
+          {
+            // ----- Enter critical section -----------------------------------
+            interrupts::critical_section ics;
+
+            utils::static_double_list_links* it = head_.next ();
+            while (it != &head_ && count > 0)
+              {
+                // Save the next, the node may be unlinked below.
+                utils::static_double_list_links* next = it->next ();
+
+                waiting_request_node* node =
+                    static_cast<waiting_request_node*> (it);
+                if (node->request_ > count)
+                  {
+                    // Do not let the following threads pass ahead.
+                    break;
+                  }
+
+                count -= node->request_;
+                node->unlink ();
+                satisfied.link (*node);
+
+                it = next;
+              }
+            // ----- Exit critical section ------------------------------------
+          }
+
+        satisfied.resume_all ();
+      }
+
       // ======================================================================
 
       timestamp_node::timestamp_node (clock::timestamp_t ts) :
@@ -296,6 +588,20 @@ namespace os
 #endif
       }
 
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+      /**
+       * @details
+       * Plain time stamp nodes (like timers) have no waiting thread.
+       */
+      rtos::thread*
+      timestamp_node::waiting_thread (void)
+      {
+        return nullptr;
+      }
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+
       // ======================================================================
 
       timeout_thread_node::timeout_thread_node (clock::timestamp_t ts,
@@ -330,6 +636,16 @@ namespace os
           }
       }
 
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+      rtos::thread*
+      timeout_thread_node::waiting_thread (void)
+      {
+        return &this->thread;
+      }
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+
       // ======================================================================
 
 #if !defined(OS_USE_RTOS_PORT_TIMER)
@@ -379,16 +695,24 @@ namespace os
        * To satisfy the circular double linked list requirements,
        * an empty list still contains the head node with references
        * to itself.
+       *
+       * With `OS_USE_RTOS_CLOCK_TIMING_WHEEL`, only the overdue
+       * time stamps are kept in the ordered list.
        */
       void
+#if !defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
       clock_timestamps_list::link (timestamp_node& node)
+#else
+      clock_timestamps_list::link_ordered_ (timestamp_node& node)
+#endif /* !defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
       {
         clock::timestamp_t timestamp = node.timestamp;
 
         timeout_thread_node* after =
             static_cast<timeout_thread_node*> (const_cast<utils::static_double_list_links *> (tail ()));
 
-        if (empty ())
+        // Only the ordered list, not the wheel.
+        if (double_list::empty ())
           {
             // Insert at the end of the list.
 #if defined(OS_TRACE_RTOS_LISTS_CLOCKS)
@@ -436,12 +760,42 @@ namespace os
         insert_after (node, after);
       }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+
+      /**
+       * @brief Update the longest interrupts masked window.
+       * @param [in] begin The high resolution time stamp when the
+       *  window was entered.
+       *
+       * @details
+       * Must be called in a critical section.
+       */
+      static inline void
+      update_masked_cycles (clock::timestamp_t begin)
+      {
+        rtos::statistics::duration_t cycles =
+            static_cast<rtos::statistics::duration_t> (hrclock.now () - begin);
+        if (cycles > scheduler::statistics::clock_expiry_max_masked_cycles_)
+          {
+            scheduler::statistics::clock_expiry_max_masked_cycles_ = cycles;
+          }
+      }
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY) */
+
       /**
        * @details
        * With the list ordered, check if the list head time stamp was
        * reached and run the node action.
        *
        * Repeat for all nodes that have overdue time stamps.
+       *
+       * With `OS_USE_RTOS_CLOCK_TIMING_WHEEL`, the wheel is first
+       * advanced to the current time stamp, which moves all due
+       * nodes to the ordered list.
+       *
+       * With `OS_USE_RTOS_CLOCK_BATCH_EXPIRY`, the overdue nodes
+       * are processed in batches, see `expire_batch_()`.
        */
       void
       clock_timestamps_list::check_timestamp (clock::timestamp_t now)
@@ -452,6 +806,32 @@ namespace os
             return;
           }
 
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+        // Timer actions may link new overdue nodes, so
+        // repeat until no more actions are performed.
+        while (expire_batch_ (now))
+          ;
+
+#else
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+          {
+            // ----- Enter critical section -----------------------------------
+            interrupts::critical_section ics;
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            clock::timestamp_t begin = hrclock.now ();
+#endif
+            advance_ (now);
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            update_masked_cycles (begin);
+#endif
+            // ----- Exit critical section ------------------------------------
+          }
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
+
         // Multiple threads can wait for the same time stamp, so
         // iterate until a node with future time stamp is identified.
         for (;;)
@@ -459,12 +839,13 @@ namespace os
             // ----- Enter critical section -----------------------------------
             interrupts::critical_section ics;
 
-            if (empty ())
-              {
-                break;
-              }
-            clock::timestamp_t head_ts = head ()->timestamp;
-            if (now >= head_ts)
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            clock::timestamp_t begin = hrclock.now ();
+#endif
+
+            // Only the ordered list, not the wheel.
+            bool due = !double_list::empty () && (now >= head ()->timestamp);
+            if (due)
               {
 #if defined(OS_TRACE_RTOS_LISTS_CLOCKS)
                 trace::printf ("%s() %u \n", __func__,
@@ -472,14 +853,492 @@ namespace os
 #endif
                 const_cast<timestamp_node*> (head ())->action ();
               }
-            else
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            update_masked_cycles (begin);
+#endif
+            if (!due)
               {
                 break;
               }
             // ----- Exit critical section ------------------------------------
           }
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+      }
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) \
+    || defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+      void
+      clock_timestamps_list::slot_list::link_tail (timestamp_node& node)
+      {
+        insert_after (node,
+                      const_cast<utils::static_double_list_links *> (tail ()));
+      }
+
+#endif
+
+#if defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY)
+
+      /**
+       * @details
+       * In a single critical section, detach all nodes with overdue
+       * time stamps, in order, and make the threads waiting for them
+       * ready; the scheduler is invoked once, after the batch.
+       *
+       * The detached timer nodes are then processed in order, each
+       * action in its own critical section, so the time spent with
+       * interrupts masked does not grow with the number of timers.
+       *
+       * Compared to the regular path, the threads are resumed before
+       * the timer actions with the same time stamp are performed.
+       *
+       * @return `true` if timer actions were performed.
+       */
+      bool
+      clock_timestamps_list::expire_batch_ (clock::timestamp_t now)
+      {
+        slot_list expired;
+        bool resumed = false;
+
+          {
+            // ----- Enter critical section -----------------------------------
+            interrupts::critical_section ics;
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            clock::timestamp_t begin = hrclock.now ();
+#endif
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+            advance_ (now);
+#endif
+
+            while (!double_list::empty ())
+              {
+                timestamp_node* node =
+                    static_cast<timestamp_node*> (const_cast<utils::static_double_list_links *> (double_list::head ()));
+                if (now < node->timestamp)
+                  {
+                    break;
+                  }
+                node->unlink ();
+
+                rtos::thread* th = node->waiting_thread ();
+                if (th == nullptr)
+                  {
+                    expired.link_tail (*node);
+                    continue;
+                  }
+
+#if defined(OS_TRACE_RTOS_LISTS_CLOCKS)
+                trace::printf ("%s() %u thread %p\n", __func__,
+                    static_cast<uint32_t> (now), th);
+#endif
+                if (th->state () != thread::state::destroyed)
+                  {
+#if defined(OS_USE_RTOS_PORT_SCHEDULER)
+                    th->resume ();
+#else
+                    th->internal_link_ready_ ();
+                    resumed = true;
+#endif
+                  }
+              }
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            update_masked_cycles (begin);
+#endif
+            // ----- Exit critical section ------------------------------------
+          }
+
+        if (resumed)
+          {
+            port::scheduler::reschedule ();
+          }
+
+        bool performed = !expired.empty ();
+
+        while (!expired.empty ())
+          {
+            // ----- Enter critical section -----------------------------------
+            interrupts::critical_section ics;
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            clock::timestamp_t begin = hrclock.now ();
+#endif
+            // Unlinked by the action; a concurrent stop might
+            // have unlinked it too.
+            if (!expired.empty ())
+              {
+                const_cast<timestamp_node*> (static_cast<volatile timestamp_node*> (expired.head ()))->action ();
+              }
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+            update_masked_cycles (begin);
+#endif
+            // ----- Exit critical section ------------------------------------
+          }
+
+        return performed;
+      }
+
+#endif /* defined(OS_USE_RTOS_CLOCK_BATCH_EXPIRY) */
+
+#if defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL)
+
+      /**
+       * @class clock_timestamps_list
+       * @details
+       * When `OS_USE_RTOS_CLOCK_TIMING_WHEEL` is defined, the
+       * future time stamps are kept in a hierarchical timing wheel,
+       * with `levels` levels of `slots` unordered lists each.
+       *
+       * Relative to the time stamp of the latest check (the base),
+       * a node is stored on the level given by the most significant
+       * group of `slot_bits` bits that differs between its time stamp
+       * and the base, in the slot given by the value of the
+       * time stamp bits in that group. Time stamps
+       * too far away are kept in an overflow list.
+       *
+       * Linking and unlinking a node are constant time. When the
+       * clock advances, the slots passed are moved to the ordered
+       * list, and the slot reached on the highest changed level is
+       * redistributed on the lower levels; for clocks advancing
+       * one tick at a time, this is amortised constant time.
+       *
+       * Nodes with equal time stamps are kept in the order they were
+       * linked, so the actions are performed in exactly the same
+       * order as with the ordered list.
+       */
+
+      void
+      clock_timestamps_list::link (timestamp_node& node)
+      {
+        if (node.timestamp <= base_)
+          {
+            // Overdue, keep it ordered, for the next check.
+            link_ordered_ (node);
+          }
+        else
+          {
+            link_wheel_ (node);
+          }
+      }
+
+      /**
+       * @details
+       * Must be called in a critical section.
+       */
+      void
+      clock_timestamps_list::link_wheel_ (timestamp_node& node)
+      {
+        uint64_t diff = static_cast<uint64_t> (node.timestamp ^ base_);
+        if ((diff >> (slot_bits * levels)) != 0)
+          {
+#if defined(OS_TRACE_RTOS_LISTS_CLOCKS)
+            trace::printf ("clock %s() overflow +%u\n", __func__,
+                static_cast<uint32_t> (node.timestamp));
+#endif
+            overflow_.link_tail (node);
+            return;
+          }
+
+        // The time stamp is in the future, so diff is not 0.
+        std::size_t level = static_cast<std::size_t> (63 - __builtin_clzll (diff))
+            / slot_bits;
+        std::size_t slot = static_cast<std::size_t> (node.timestamp
+            >> (slot_bits * level)) & (slots - 1);
+
+#if defined(OS_TRACE_RTOS_LISTS_CLOCKS)
+        trace::printf ("clock %s() %u/%u +%u\n", __func__, level, slot,
+            static_cast<uint32_t> (node.timestamp));
+#endif
+
+        wheel_[level][slot].link_tail (node);
+        map_[level] |= (static_cast<uint64_t> (1) << slot);
+      }
+
+      /**
+       * @details
+       * Move the nodes from the selected slots of a level to the
+       * ordered list, in ascending slot order.
+       *
+       * Must be called in a critical section.
+       */
+      void
+      clock_timestamps_list::order_slots_ (std::size_t level, uint64_t mask)
+      {
+        uint64_t bits = map_[level] & mask;
+        map_[level] &= ~mask;
+
+        while (bits != 0)
+          {
+            std::size_t slot = static_cast<std::size_t> (__builtin_ctzll (bits));
+            bits &= (bits - 1);
+
+            slot_list& list = wheel_[level][slot];
+            while (!list.empty ())
+              {
+                timestamp_node* node =
+                    static_cast<timestamp_node*> (const_cast<utils::static_double_list_links *> (list.head ()));
+                node->unlink ();
+                link_ordered_ (*node);
+              }
+          }
+      }
+
+      /**
+       * @details
+       * Link again all nodes in a list, relative to the current base.
+       *
+       * Must be called in a critical section.
+       */
+      void
+      clock_timestamps_list::relink_ (slot_list& list)
+      {
+        // Detach all nodes first, since they might be linked back
+        // to the same list.
+        slot_list tmp;
+        while (!list.empty ())
+          {
+            timestamp_node* node =
+                static_cast<timestamp_node*> (const_cast<utils::static_double_list_links *> (list.head ()));
+            node->unlink ();
+            tmp.link_tail (*node);
+          }
+
+        while (!tmp.empty ())
+          {
+            timestamp_node* node =
+                static_cast<timestamp_node*> (const_cast<utils::static_double_list_links *> (tmp.head ()));
+            node->unlink ();
+            link (*node);
+          }
       }
 
+      /**
+       * @details
+       * The nodes in the levels below the highest changed level,
+       * and those in the slots passed on the highest changed level,
+       * are all due, so they are moved to the ordered list,
+       * starting with the higher levels, which hold the nodes
+       * linked earlier, to preserve the order of the nodes with equal
+       * time stamps.
+       *
+       * The slot reached on the highest changed level is redistributed
+       * relative to the new base, either to the lower levels, which are
+       * now empty, or to the ordered list.
+       *
+       * Must be called in a critical section.
+       */
+      void
+      clock_timestamps_list::advance_ (clock::timestamp_t now)
+      {
+        if (now == base_)
+          {
+            return;
+          }
+
+        if (now < base_)
+          {
+            // Only adjustable clocks might go back in time.
+            rebase_ (now);
+            return;
+          }
+
+        uint64_t diff = static_cast<uint64_t> (now ^ base_);
+        std::size_t top = static_cast<std::size_t> (63 - __builtin_clzll (diff))
+            / slot_bits;
+
+        if (top >= levels)
+          {
+            // All nodes in the wheel are due.
+            for (std::size_t level = levels; level-- > 0;)
+              {
+                order_slots_ (level, ~static_cast<uint64_t> (0));
+              }
+            base_ = now;
+
+            // The far away nodes might now fit in the wheel.
+            relink_ (overflow_);
+            return;
+          }
+
+        std::size_t from = (static_cast<std::size_t> (base_
+            >> (slot_bits * top)) & (slots - 1)) + 1;
+        std::size_t to = static_cast<std::size_t> (now >> (slot_bits * top))
+            & (slots - 1);
+
+        // The slots passed on the top level, [from, to).
+        uint64_t mask = ((static_cast<uint64_t> (1) << to) - 1)
+            & ~((static_cast<uint64_t> (1) << from) - 1);
+        order_slots_ (top, mask);
+
+        // All lower levels.
+        for (std::size_t level = top; level-- > 0;)
+          {
+            order_slots_ (level, ~static_cast<uint64_t> (0));
+          }
+
+        base_ = now;
+
+        // Redistribute the reached slot.
+        map_[top] &= ~(static_cast<uint64_t> (1) << to);
+        relink_ (wheel_[top][to]);
+      }
+
+      /**
+       * @details
+       * Used when the time goes back, which for adjustable clocks
+       * may happen when the offset is decreased. All nodes are linked
+       * again relative to the new base, in ascending time stamp order.
+       *
+       * Must be called in a critical section.
+       */
+      void
+      clock_timestamps_list::rebase_ (clock::timestamp_t now)
+      {
+        // Move everything to the ordered list.
+        for (std::size_t level = levels; level-- > 0;)
+          {
+            order_slots_ (level, ~static_cast<uint64_t> (0));
+          }
+        while (!overflow_.empty ())
+          {
+            timestamp_node* node =
+                static_cast<timestamp_node*> (const_cast<utils::static_double_list_links *> (overflow_.head ()));
+            node->unlink ();
+            link_ordered_ (*node);
+          }
+
+        base_ = now;
+
+        // The future nodes are at the end of the ordered list;
+        // find the first one, and move them in order.
+        utils::static_double_list_links* first = &head_;
+        while ((first->prev () != &head_)
+            && (static_cast<timestamp_node*> (first->prev ())->timestamp > base_))
+          {
+            first = first->prev ();
+          }
+
+        while (first != &head_)
+          {
+            timestamp_node* node = static_cast<timestamp_node*> (first);
+            first = first->next ();
+            node->unlink ();
+            link_wheel_ (*node);
+          }
+      }
+
+      bool
+      clock_timestamps_list::empty (void) const
+      {
+        if (!double_list::empty () || !overflow_.empty ())
+          {
+            return false;
+          }
+
+        for (std::size_t level = 0; level < levels; ++level)
+          {
+            uint64_t bits = map_[level];
+            while (bits != 0)
+              {
+                std::size_t slot =
+                    static_cast<std::size_t> (__builtin_ctzll (bits));
+                bits &= (bits - 1);
+                if (!wheel_[level][slot].empty ())
+                  {
+                    return false;
+                  }
+              }
+          }
+        return true;
+      }
+
+      /**
+       * @details
+       * Return the node with the earliest time stamp, either the
+       * head of the ordered list, or the first node with the lowest
+       * time stamp in the first non-empty slot of the lowest
+       * non-empty level (or in the overflow list).
+       *
+       * If there are no nodes, the ordered list head is returned,
+       * like for the ordered list.
+       *
+       * This is not constant time: finding the slot checks at most
+       * `levels * slots` slots (the map bits are not cleared when the
+       * nodes are unlinked, so a set bit may mark an empty slot), and
+       * on the levels above 0, or in the overflow list, the whole slot
+       * is searched for the lowest time stamp. All nodes in a level 0
+       * slot have the same time stamp, so the first one is returned.
+       * This is called by the tickless idle mode, usually when no
+       * deadline is close, which is the most expensive case.
+       *
+       * Must be called in a critical section.
+       */
+      volatile timestamp_node*
+      clock_timestamps_list::head (void) const
+      {
+        if (!double_list::empty ())
+          {
+            return static_cast<volatile timestamp_node*> (double_list::head ());
+          }
+
+        const utils::double_list* list = nullptr;
+        std::size_t level = 0;
+        for (; (level < levels) && (list == nullptr); ++level)
+          {
+            uint64_t bits = map_[level];
+            while (bits != 0)
+              {
+                std::size_t slot =
+                    static_cast<std::size_t> (__builtin_ctzll (bits));
+                bits &= (bits - 1);
+                if (!wheel_[level][slot].empty ())
+                  {
+                    list = &wheel_[level][slot];
+                    break;
+                  }
+              }
+          }
+
+        if (list != nullptr && level == 1)
+          {
+            // Found on level 0, all time stamps are equal.
+            return static_cast<volatile timestamp_node*> (list->head ());
+          }
+
+        if (list == nullptr)
+          {
+            if (overflow_.empty ())
+              {
+                return static_cast<volatile timestamp_node*> (double_list::head ());
+              }
+            list = &overflow_;
+          }
+
+        // Slots on higher levels are not ordered, search the lowest
+        // time stamp, the first one if more are equal.
+        timestamp_node* earliest =
+            static_cast<timestamp_node*> (const_cast<utils::static_double_list_links *> (list->head ()));
+        // The previous of the first node is the list head.
+        utils::static_double_list_links* end = earliest->prev ();
+        for (utils::static_double_list_links* p = earliest->next (); p != end;
+            p = p->next ())
+          {
+            timestamp_node* node = static_cast<timestamp_node*> (p);
+            if (node->timestamp < earliest->timestamp)
+              {
+                earliest = node;
+              }
+          }
+        return earliest;
+      }
+
+#endif /* defined(OS_USE_RTOS_CLOCK_TIMING_WHEEL) */
+
       // ======================================================================
 
       void
@@ -504,6 +1363,30 @@ namespace os
         insert_after (node, after);
       }
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+      // ======================================================================
+
+      /**
+       * @details
+       * Must be called in a critical section.
+       */
+      void
+      timer_nodes_list::link (timer_node& node)
+      {
+        if (head_.prev () == nullptr)
+          {
+            // If this is the first time, initialise the list to empty.
+            clear ();
+          }
+
+        insert_after (node,
+                      const_cast<utils::static_double_list_links *> (tail ()));
+      }
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
     // ------------------------------------------------------------------------
     } /* namespace internal */
   } /* namespace rtos */
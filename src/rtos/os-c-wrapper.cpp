@@ -111,6 +111,9 @@ static_assert(alignof(os_mutex_protocol_t) == alignof(mutex::protocol_t), "adjus
 static_assert(sizeof(os_mutex_robustness_t) == sizeof(mutex::robustness_t), "adjust size of os_mutex_robustness_t");
 static_assert(alignof(os_mutex_robustness_t) == alignof(mutex::robustness_t), "adjust align of os_mutex_robustness_t");
 
+static_assert(sizeof(os_rwlock_count_t) == sizeof(rwlock::count_t), "adjust size of os_rwlock_count_t");
+static_assert(alignof(os_rwlock_count_t) == alignof(rwlock::count_t), "adjust align of os_rwlock_count_t");
+
 static_assert(sizeof(os_semaphore_count_t) == sizeof(semaphore::count_t), "adjust size of os_semaphore_count_t");
 static_assert(alignof(os_semaphore_count_t) == alignof(semaphore::count_t), "adjust align of os_semaphore_count_t");
 
@@ -192,6 +195,12 @@ static_assert(offsetof(rtos::thread::attributes, th_priority) == offsetof(os_thr
 static_assert(sizeof(rtos::timer) == sizeof(os_timer_t), "adjust size of os_timer_t");
 static_assert(sizeof(rtos::timer::attributes) == sizeof(os_timer_attr_t), "adjust size of os_timer_attr_t");
 static_assert(offsetof(rtos::timer::attributes, tm_type) == offsetof(os_timer_attr_t, tm_type), "adjust os_timer_attr_t members");
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+static_assert(offsetof(rtos::timer::attributes, tm_in_isr) == offsetof(os_timer_attr_t, tm_in_isr), "adjust os_timer_attr_t members");
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+static_assert(offsetof(rtos::timer::attributes, tm_slack) == offsetof(os_timer_attr_t, tm_slack), "adjust os_timer_attr_t members");
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
 
 static_assert(sizeof(rtos::mutex) == sizeof(os_mutex_t), "adjust size of os_mutex_t");
 static_assert(sizeof(rtos::mutex::attributes) == sizeof(os_mutex_attr_t), "adjust size of os_mutex_attr_t");
@@ -204,6 +213,10 @@ static_assert(offsetof(rtos::mutex::attributes, mx_max_count) == offsetof(os_mut
 static_assert(sizeof(rtos::condition_variable) == sizeof(os_condvar_t), "adjust size of os_condvar_t");
 static_assert(sizeof(rtos::condition_variable::attributes) == sizeof(os_condvar_attr_t), "adjust size of os_condvar_attr_t");
 
+static_assert(sizeof(rtos::rwlock) == sizeof(os_rwlock_t), "adjust size of os_rwlock_t");
+static_assert(sizeof(rtos::rwlock::attributes) == sizeof(os_rwlock_attr_t), "adjust size of os_rwlock_attr_t");
+static_assert(offsetof(rtos::rwlock::attributes, rw_max_readers) == offsetof(os_rwlock_attr_t, rw_max_readers), "adjust os_rwlock_attr_t members");
+
 static_assert(sizeof(rtos::semaphore) == sizeof(os_semaphore_t), "adjust size of os_semaphore_t");
 static_assert(sizeof(rtos::semaphore::attributes) == sizeof(os_semaphore_attr_t), "adjust size of os_semaphore_attr_t");
 static_assert(offsetof(rtos::semaphore::attributes, sm_initial_value) == offsetof(os_semaphore_attr_t, sm_initial_value), "adjust os_semaphore_attr_t members");
@@ -215,6 +228,8 @@ static_assert(offsetof(rtos::memory_pool::attributes, mp_pool_address) == offset
 static_assert(offsetof(rtos::memory_pool::attributes, mp_pool_size_bytes) == offsetof(os_mempool_attr_t, mp_pool_size_bytes), "adjust os_mempool_attr_t members");
 
 static_assert(sizeof(rtos::message_queue) == sizeof(os_mqueue_t), "adjust size of os_mqueue_t");
+
+static_assert(sizeof(rtos::mpmc_queue_base) == sizeof(os_mpmc_queue_t), "adjust size of os_mpmc_queue_t");
 static_assert(sizeof(rtos::message_queue::attributes) == sizeof(os_mqueue_attr_t), "adjust size of os_mqueue_attr_t");
 static_assert(offsetof(rtos::message_queue::attributes, mq_queue_address) == offsetof(os_mqueue_attr_t, mq_queue_addr), "adjust os_mqueue_attr_t members");
 static_assert(offsetof(rtos::message_queue::attributes, mq_queue_size_bytes) == offsetof(os_mqueue_attr_t, mq_queue_size_bytes), "adjust os_mqueue_attr_t members");
@@ -1912,6 +1927,130 @@ os_mutex_reset (os_mutex_t* mutex)
   return (os_result_t) (reinterpret_cast<rtos::mutex&> (*mutex)).reset ();
 }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::acquisitions()
+ */
+os_statistics_counter_t
+os_mutex_stat_get_acquisitions (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_counter_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().acquisitions ());
+}
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::contended_acquisitions()
+ */
+os_statistics_counter_t
+os_mutex_stat_get_contended_acquisitions (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_counter_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().contended_acquisitions ());
+}
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::wait_cycles()
+ */
+os_statistics_duration_t
+os_mutex_stat_get_wait_cycles (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_duration_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().wait_cycles ());
+}
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::max_wait_cycles()
+ */
+os_statistics_duration_t
+os_mutex_stat_get_max_wait_cycles (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_duration_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().max_wait_cycles ());
+}
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::hold_cycles()
+ */
+os_statistics_duration_t
+os_mutex_stat_get_hold_cycles (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_duration_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().hold_cycles ());
+}
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::max_hold_cycles()
+ */
+os_statistics_duration_t
+os_mutex_stat_get_max_hold_cycles (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_duration_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().max_hold_cycles ());
+}
+
+/**
+ * @details
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::boosts()
+ */
+os_statistics_counter_t
+os_mutex_stat_get_boosts (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  return static_cast<os_statistics_counter_t> ((reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().boosts ());
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::statistics::clear()
+ */
+void
+os_mutex_stat_clear (os_mutex_t* mutex)
+{
+  assert (mutex != nullptr);
+  (reinterpret_cast<rtos::mutex&> (*mutex)).statistics ().clear ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::mutex::trace_print_all_statistics()
+ */
+void
+os_mutex_stat_trace_print_all (void)
+{
+  rtos::mutex::trace_print_all_statistics ();
+}
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
 // ----------------------------------------------------------------------------
 
 /**
@@ -2098,298 +2237,270 @@ os_condvar_timed_wait (os_condvar_t* condvar, os_mutex_t* mutex,
 /**
  * @details
  *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::attributes
+ *  @ref os::rtos::rwlock::attributes
  */
 void
-os_semaphore_attr_init (os_semaphore_attr_t* attr)
+os_rwlock_attr_init (os_rwlock_attr_t* attr)
 {
   assert (attr != nullptr);
-  new (attr) semaphore::attributes
-    { };
+  new (attr) rwlock::attributes ();
 }
 
 /**
  * @details
  *
+ * @note Must be paired with `os_rwlock_destruct()`.
+ *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::attributes_binary
+ *  @ref os::rtos::rwlock
  */
 void
-os_semaphore_attr_binary_init (os_semaphore_attr_t* attr,
-                               const os_semaphore_count_t initial_value)
+os_rwlock_construct (os_rwlock_t* rwlock, const char* name,
+                     const os_rwlock_attr_t* attr)
 {
-  assert (attr != nullptr);
-  new (attr) semaphore::attributes_binary
-    { initial_value };
+  assert (rwlock != nullptr);
+  if (attr == nullptr)
+    {
+      attr = (const os_rwlock_attr_t*) &rwlock::initializer;
+    }
+  new (rwlock) rtos::rwlock (name, (rwlock::attributes&) *attr);
 }
 
 /**
  * @details
  *
+ * @note Must be paired with `os_rwlock_construct()`.
+ *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::attributes_counting
+ *  @ref os::rtos::rwlock
  */
 void
-os_semaphore_attr_counting_init (os_semaphore_attr_t* attr,
-                                 const os_semaphore_count_t max_value,
-                                 const os_semaphore_count_t initial_value)
+os_rwlock_destruct (os_rwlock_t* rwlock)
 {
-  assert (attr != nullptr);
-  new (attr) semaphore::attributes_counting
-    { max_value, initial_value };
+  assert (rwlock != nullptr);
+  (reinterpret_cast<rtos::rwlock&> (*rwlock)).~rwlock ();
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
- *
- * @par For the complete definition, see
- *  @ref os::rtos::semaphore::initializer_binary
- */
-const os_semaphore_attr_t*
-os_semaphore_attr_get_binary (void)
-{
-  return (const os_semaphore_attr_t*) &semaphore::initializer_binary;
-}
-
-/**
- * @details
+ * Dynamically allocate the read-write lock object instance using the RTOS
+ * system allocator and construct it.
  *
- * @note Must be paired with `os_semaphore_destruct()`.
+ * @note Equivalent of C++ `new rwlock(...)`.
+ * @note Must be paired with `os_rwlock_delete()`.
  *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore
+ *  @ref os::rtos::rwlock
  */
-void
-os_semaphore_construct (os_semaphore_t* semaphore, const char* name,
-                        const os_semaphore_attr_t* attr)
+os_rwlock_t*
+os_rwlock_new (const char* name, const os_rwlock_attr_t* attr)
 {
-  assert (semaphore != nullptr);
   if (attr == nullptr)
     {
-      attr = (const os_semaphore_attr_t*) &semaphore::initializer_binary;
+      attr = (const os_rwlock_attr_t*) &rwlock::initializer;
     }
-  new (semaphore) rtos::semaphore
-    { name, (semaphore::attributes&) *attr };
+  return reinterpret_cast<os_rwlock_t*> (new rwlock (
+      name, (rwlock::attributes&) *attr));
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_semaphore_destruct()`.
+ * Destruct the read-write lock and deallocate the dynamically allocated
+ * space using the RTOS system allocator.
+ *
+ * @note Equivalent of C++ `delete ptr_rwlock`.
+ * @note Must be paired with `os_rwlock_new()`.
  *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore_binary
+ *  @ref os::rtos::rwlock
  */
 void
-os_semaphore_binary_construct (os_semaphore_t* semaphore, const char* name,
-                               const os_semaphore_count_t initial_value)
+os_rwlock_delete (os_rwlock_t* rwlock)
 {
-  assert (semaphore != nullptr);
-  new (semaphore) rtos::semaphore_binary
-    { name, initial_value };
+  assert (rwlock != nullptr);
+  delete reinterpret_cast<rtos::rwlock*> (rwlock);
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_semaphore_destruct()`.
- *
- * @warning Cannot be invoked from Interrupt Service Routines.
+ * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore_counting
+ *  @ref os::rtos::rwlock::name()
  */
-void
-os_semaphore_counting_construct (os_semaphore_t* semaphore, const char* name,
-                                 const os_semaphore_count_t max_value,
-                                 const os_semaphore_count_t initial_value)
+const char*
+os_rwlock_get_name (os_rwlock_t* rwlock)
 {
-  assert (semaphore != nullptr);
-  new (semaphore) rtos::semaphore_counting
-    { name, max_value, initial_value };
+  assert (rwlock != nullptr);
+  return (reinterpret_cast<rtos::rwlock&> (*rwlock)).name ();
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_semaphore_construct()` or
- * `os_semaphore_binary_construct()` or `os_semaphore_counting_construct()`.
- *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore
+ *  @ref os::rtos::rwlock::read_lock()
  */
-void
-os_semaphore_destruct (os_semaphore_t* semaphore)
+os_result_t
+os_rwlock_read_lock (os_rwlock_t* rwlock)
 {
-  assert (semaphore != nullptr);
-  (reinterpret_cast<rtos::semaphore&> (*semaphore)).~semaphore ();
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).read_lock ();
 }
 
 /**
  * @details
  *
- * Dynamically allocate the semaphore object instance using the RTOS
- * system allocator and construct it.
- *
- * @note Equivalent of C++ `new semaphore(...)`.
- * @note Must be paired with `os_semaphore_delete()`.
- *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore
+ *  @ref os::rtos::rwlock::try_read_lock()
  */
-os_semaphore_t*
-os_semaphore_new (const char* name, const os_semaphore_attr_t* attr)
+os_result_t
+os_rwlock_try_read_lock (os_rwlock_t* rwlock)
 {
-  if (attr == nullptr)
-    {
-      attr = (const os_semaphore_attr_t*) &semaphore::initializer_binary;
-    }
-  return reinterpret_cast<os_semaphore_t*> (new rtos::semaphore
-    { name, (semaphore::attributes&) *attr });
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).try_read_lock ();
 }
 
 /**
  * @details
  *
- * Dynamically allocate the binary semaphore object instance using the RTOS
- * system allocator and construct it.
- *
- * @note Equivalent of C++ `new semaphore_binary(...)`.
- * @note Must be paired with `os_semaphore_delete()`.
- *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore_binary
+ *  @ref os::rtos::rwlock::timed_read_lock()
  */
-os_semaphore_t*
-os_semaphore_binary_new (const char* name,
-                         const os_semaphore_count_t initial_value)
+os_result_t
+os_rwlock_timed_read_lock (os_rwlock_t* rwlock, os_clock_duration_t timeout)
 {
-  return reinterpret_cast<os_semaphore_t*> (new rtos::semaphore_binary
-    { name, initial_value });
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).timed_read_lock (
+      timeout);
 }
 
 /**
  * @details
  *
- * Dynamically allocate the counting semaphore object instance using the RTOS
- * system allocator and construct it.
- *
- * @note Equivalent of C++ `new semaphore_counting(...)`.
- * @note Must be paired with `os_semaphore_delete()`.
- *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore_counting
+ *  @ref os::rtos::rwlock::write_lock()
  */
-os_semaphore_t*
-os_semaphore_counting_new (const char* name,
-                           const os_semaphore_count_t max_value,
-                           const os_semaphore_count_t initial_value)
+os_result_t
+os_rwlock_write_lock (os_rwlock_t* rwlock)
 {
-  return reinterpret_cast<os_semaphore_t*> (new rtos::semaphore_counting
-    { name, max_value, initial_value });
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).write_lock ();
 }
 
 /**
  * @details
  *
- * Destruct the semaphore and deallocate the dynamically allocated
- * space using the RTOS system allocator.
- *
- * @note Equivalent of C++ `delete ptr_semaphore`.
- * @note Must be paired with `os_semaphore_new()` or
- * `os_semaphore_binary_new()` or `os_semaphore_counting_new()`.
- *
+
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore
+ *  @ref os::rtos::rwlock::try_write_lock()
  */
-void
-os_semaphore_delete (os_semaphore_t* semaphore)
+os_result_t
+os_rwlock_try_write_lock (os_rwlock_t* rwlock)
 {
-  assert (semaphore != nullptr);
-  delete reinterpret_cast<rtos::semaphore*> (semaphore);
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).try_write_lock ();
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::name()
+ *  @ref os::rtos::rwlock::timed_write_lock()
  */
-const char*
-os_semaphore_get_name (os_semaphore_t* semaphore)
+os_result_t
+os_rwlock_timed_write_lock (os_rwlock_t* rwlock, os_clock_duration_t timeout)
 {
-  assert (semaphore != nullptr);
-  return (reinterpret_cast<rtos::semaphore&> (*semaphore)).name ();
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).timed_write_lock (
+      timeout);
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::post()
+ *  @ref os::rtos::rwlock::unlock()
  */
 os_result_t
-os_semaphore_post (os_semaphore_t* semaphore)
+os_rwlock_unlock (os_rwlock_t* rwlock)
 {
-  assert (semaphore != nullptr);
-  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).post ();
+  assert (rwlock != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::rwlock&> (*rwlock)).unlock ();
 }
 
+// ----------------------------------------------------------------------------
+
 /**
  * @details
  *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::wait()
+ *  @ref os::rtos::semaphore::attributes
  */
-os_result_t
-os_semaphore_wait (os_semaphore_t* semaphore)
+void
+os_semaphore_attr_init (os_semaphore_attr_t* attr)
 {
-  assert (semaphore != nullptr);
-  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).wait ();
+  assert (attr != nullptr);
+  new (attr) semaphore::attributes
+    { };
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::try_wait()
+ *  @ref os::rtos::semaphore::attributes_binary
  */
-os_result_t
-os_semaphore_try_wait (os_semaphore_t* semaphore)
+void
+os_semaphore_attr_binary_init (os_semaphore_attr_t* attr,
+                               const os_semaphore_count_t initial_value)
 {
-  assert (semaphore != nullptr);
-  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).try_wait ();
+  assert (attr != nullptr);
+  new (attr) semaphore::attributes_binary
+    { initial_value };
 }
 
 /**
@@ -2398,14 +2509,16 @@ os_semaphore_try_wait (os_semaphore_t* semaphore)
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::timed_wait()
+ *  @ref os::rtos::semaphore::attributes_counting
  */
-os_result_t
-os_semaphore_timed_wait (os_semaphore_t* semaphore, os_clock_duration_t timeout)
+void
+os_semaphore_attr_counting_init (os_semaphore_attr_t* attr,
+                                 const os_semaphore_count_t max_value,
+                                 const os_semaphore_count_t initial_value)
 {
-  assert (semaphore != nullptr);
-  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).timed_wait (
-      timeout);
+  assert (attr != nullptr);
+  new (attr) semaphore::attributes_counting
+    { max_value, initial_value };
 }
 
 /**
@@ -2414,162 +2527,184 @@ os_semaphore_timed_wait (os_semaphore_t* semaphore, os_clock_duration_t timeout)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::value()
+ *  @ref os::rtos::semaphore::initializer_binary
  */
-os_semaphore_count_t
-os_semaphore_get_value (os_semaphore_t* semaphore)
+const os_semaphore_attr_t*
+os_semaphore_attr_get_binary (void)
 {
-  assert (semaphore != nullptr);
-  return (os_semaphore_count_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).value ();
+  return (const os_semaphore_attr_t*) &semaphore::initializer_binary;
 }
 
 /**
  * @details
  *
+ * @note Must be paired with `os_semaphore_destruct()`.
+ *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::reset()
+ *  @ref os::rtos::semaphore
  */
-os_result_t
-os_semaphore_reset (os_semaphore_t* semaphore)
+void
+os_semaphore_construct (os_semaphore_t* semaphore, const char* name,
+                        const os_semaphore_attr_t* attr)
 {
   assert (semaphore != nullptr);
-  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).reset ();
+  if (attr == nullptr)
+    {
+      attr = (const os_semaphore_attr_t*) &semaphore::initializer_binary;
+    }
+  new (semaphore) rtos::semaphore
+    { name, (semaphore::attributes&) *attr };
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @note Must be paired with `os_semaphore_destruct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::initial_value()
+ *  @ref os::rtos::semaphore_binary
  */
-os_semaphore_count_t
-os_semaphore_get_initial_value (os_semaphore_t* semaphore)
+void
+os_semaphore_binary_construct (os_semaphore_t* semaphore, const char* name,
+                               const os_semaphore_count_t initial_value)
 {
   assert (semaphore != nullptr);
-  return (os_semaphore_count_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).initial_value ();
+  new (semaphore) rtos::semaphore_binary
+    { name, initial_value };
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @note Must be paired with `os_semaphore_destruct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::semaphore::max_value()
+ *  @ref os::rtos::semaphore_counting
  */
-os_semaphore_count_t
-os_semaphore_get_max_value (os_semaphore_t* semaphore)
+void
+os_semaphore_counting_construct (os_semaphore_t* semaphore, const char* name,
+                                 const os_semaphore_count_t max_value,
+                                 const os_semaphore_count_t initial_value)
 {
   assert (semaphore != nullptr);
-  return (os_semaphore_count_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).max_value ();
+  new (semaphore) rtos::semaphore_counting
+    { name, max_value, initial_value };
 }
 
-// ----------------------------------------------------------------------------
-
 /**
  * @details
  *
+ * @note Must be paired with `os_semaphore_construct()` or
+ * `os_semaphore_binary_construct()` or `os_semaphore_counting_construct()`.
+ *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::attributes
+ *  @ref os::rtos::semaphore
  */
 void
-os_mempool_attr_init (os_mempool_attr_t* attr)
+os_semaphore_destruct (os_semaphore_t* semaphore)
 {
-  assert (attr != nullptr);
-  new (attr) memory_pool::attributes ();
+  assert (semaphore != nullptr);
+  (reinterpret_cast<rtos::semaphore&> (*semaphore)).~semaphore ();
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_mempool_destruct()`.
+ * Dynamically allocate the semaphore object instance using the RTOS
+ * system allocator and construct it.
+ *
+ * @note Equivalent of C++ `new semaphore(...)`.
+ * @note Must be paired with `os_semaphore_delete()`.
  *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool
+ *  @ref os::rtos::semaphore
  */
-void
-os_mempool_construct (os_mempool_t* mempool, const char* name, size_t blocks,
-                      size_t block_size_bytes, const os_mempool_attr_t* attr)
+os_semaphore_t*
+os_semaphore_new (const char* name, const os_semaphore_attr_t* attr)
 {
-  assert (mempool != nullptr);
   if (attr == nullptr)
     {
-      attr = (const os_mempool_attr_t*) &memory_pool::initializer;
+      attr = (const os_semaphore_attr_t*) &semaphore::initializer_binary;
     }
-  new (mempool) memory_pool (name, blocks, block_size_bytes,
-                             (memory_pool::attributes&) *attr);
+  return reinterpret_cast<os_semaphore_t*> (new rtos::semaphore
+    { name, (semaphore::attributes&) *attr });
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_mempool_construct()`.
+ * Dynamically allocate the binary semaphore object instance using the RTOS
+ * system allocator and construct it.
+ *
+ * @note Equivalent of C++ `new semaphore_binary(...)`.
+ * @note Must be paired with `os_semaphore_delete()`.
  *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool
+ *  @ref os::rtos::semaphore_binary
  */
-void
-os_mempool_destruct (os_mempool_t* mempool)
+os_semaphore_t*
+os_semaphore_binary_new (const char* name,
+                         const os_semaphore_count_t initial_value)
 {
-  assert (mempool != nullptr);
-  (reinterpret_cast<memory_pool&> (*mempool)).~memory_pool ();
+  return reinterpret_cast<os_semaphore_t*> (new rtos::semaphore_binary
+    { name, initial_value });
 }
 
 /**
  * @details
  *
- * Dynamically allocate the memory pool object instance using the RTOS
+ * Dynamically allocate the counting semaphore object instance using the RTOS
  * system allocator and construct it.
  *
- * @note Equivalent of C++ `new memory_pool(...)`.
- * @note Must be paired with `os_mempool_delete()`.
+ * @note Equivalent of C++ `new semaphore_counting(...)`.
+ * @note Must be paired with `os_semaphore_delete()`.
  *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool
+ *  @ref os::rtos::semaphore_counting
  */
-os_mempool_t*
-os_mempool_new (const char* name, size_t blocks, size_t block_size_bytes,
-                const os_mempool_attr_t* attr)
+os_semaphore_t*
+os_semaphore_counting_new (const char* name,
+                           const os_semaphore_count_t max_value,
+                           const os_semaphore_count_t initial_value)
 {
-  if (attr == nullptr)
-    {
-      attr = (const os_mempool_attr_t*) &memory_pool::initializer;
-    }
-  return reinterpret_cast<os_mempool_t*> (new memory_pool (
-      name, blocks, block_size_bytes, (memory_pool::attributes&) *attr));
+  return reinterpret_cast<os_semaphore_t*> (new rtos::semaphore_counting
+    { name, max_value, initial_value });
 }
 
 /**
  * @details
  *
- * Destruct the memory pool and deallocate the dynamically allocated
+ * Destruct the semaphore and deallocate the dynamically allocated
  * space using the RTOS system allocator.
  *
- * @note Equivalent of C++ `delete ptr_mempool`.
- * @note Must be paired with `os_mempool_new()`.
+ * @note Equivalent of C++ `delete ptr_semaphore`.
+ * @note Must be paired with `os_semaphore_new()` or
+ * `os_semaphore_binary_new()` or `os_semaphore_counting_new()`.
  *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool
+ *  @ref os::rtos::semaphore
  */
 void
-os_mempool_delete (os_mempool_t* mempool)
+os_semaphore_delete (os_semaphore_t* semaphore)
 {
-  assert (mempool != nullptr);
-  delete reinterpret_cast<memory_pool*> (mempool);
+  assert (semaphore != nullptr);
+  delete reinterpret_cast<rtos::semaphore*> (semaphore);
 }
 
 /**
@@ -2578,13 +2713,808 @@ os_mempool_delete (os_mempool_t* mempool)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::name()
+ *  @ref os::rtos::semaphore::name()
  */
 const char*
-os_mempool_get_name (os_mempool_t* mempool)
+os_semaphore_get_name (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (reinterpret_cast<rtos::semaphore&> (*semaphore)).name ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::post()
+ */
+os_result_t
+os_semaphore_post (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).post ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::wait()
+ */
+os_result_t
+os_semaphore_wait (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).wait ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::try_wait()
+ */
+os_result_t
+os_semaphore_try_wait (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).try_wait ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::timed_wait()
+ */
+os_result_t
+os_semaphore_timed_wait (os_semaphore_t* semaphore, os_clock_duration_t timeout)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).timed_wait (
+      timeout);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::post(count_t)
+ */
+os_result_t
+os_semaphore_post_n (os_semaphore_t* semaphore, os_semaphore_count_t n)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).post (
+      n);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::wait(count_t)
+ */
+os_result_t
+os_semaphore_wait_n (os_semaphore_t* semaphore, os_semaphore_count_t n)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).wait (
+      n);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::try_wait(count_t)
+ */
+os_result_t
+os_semaphore_try_wait_n (os_semaphore_t* semaphore, os_semaphore_count_t n)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).try_wait (
+      n);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::timed_wait(count_t, clock::duration_t)
+ */
+os_result_t
+os_semaphore_timed_wait_n (os_semaphore_t* semaphore, os_semaphore_count_t n,
+                           os_clock_duration_t timeout)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).timed_wait (
+      n, timeout);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::value()
+ */
+os_semaphore_count_t
+os_semaphore_get_value (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_semaphore_count_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).value ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::reset()
+ */
+os_result_t
+os_semaphore_reset (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_result_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).reset ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::initial_value()
+ */
+os_semaphore_count_t
+os_semaphore_get_initial_value (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_semaphore_count_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).initial_value ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::semaphore::max_value()
+ */
+os_semaphore_count_t
+os_semaphore_get_max_value (os_semaphore_t* semaphore)
+{
+  assert (semaphore != nullptr);
+  return (os_semaphore_count_t) (reinterpret_cast<rtos::semaphore&> (*semaphore)).max_value ();
+}
+
+// ----------------------------------------------------------------------------
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::attributes
+ */
+void
+os_mempool_attr_init (os_mempool_attr_t* attr)
+{
+  assert (attr != nullptr);
+  new (attr) memory_pool::attributes ();
+}
+
+/**
+ * @details
+ *
+ * @note Must be paired with `os_mempool_destruct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool
+ */
+void
+os_mempool_construct (os_mempool_t* mempool, const char* name, size_t blocks,
+                      size_t block_size_bytes, const os_mempool_attr_t* attr)
+{
+  assert (mempool != nullptr);
+  if (attr == nullptr)
+    {
+      attr = (const os_mempool_attr_t*) &memory_pool::initializer;
+    }
+  new (mempool) memory_pool (name, blocks, block_size_bytes,
+                             (memory_pool::attributes&) *attr);
+}
+
+/**
+ * @details
+ *
+ * @note Must be paired with `os_mempool_construct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool
+ */
+void
+os_mempool_destruct (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  (reinterpret_cast<memory_pool&> (*mempool)).~memory_pool ();
+}
+
+/**
+ * @details
+ *
+ * Dynamically allocate the memory pool object instance using the RTOS
+ * system allocator and construct it.
+ *
+ * @note Equivalent of C++ `new memory_pool(...)`.
+ * @note Must be paired with `os_mempool_delete()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool
+ */
+os_mempool_t*
+os_mempool_new (const char* name, size_t blocks, size_t block_size_bytes,
+                const os_mempool_attr_t* attr)
+{
+  if (attr == nullptr)
+    {
+      attr = (const os_mempool_attr_t*) &memory_pool::initializer;
+    }
+  return reinterpret_cast<os_mempool_t*> (new memory_pool (
+      name, blocks, block_size_bytes, (memory_pool::attributes&) *attr));
+}
+
+/**
+ * @details
+ *
+ * Destruct the memory pool and deallocate the dynamically allocated
+ * space using the RTOS system allocator.
+ *
+ * @note Equivalent of C++ `delete ptr_mempool`.
+ * @note Must be paired with `os_mempool_new()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool
+ */
+void
+os_mempool_delete (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  delete reinterpret_cast<memory_pool*> (mempool);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::name()
+ */
+const char*
+os_mempool_get_name (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).name ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::alloc()
+ */
+void*
+os_mempool_alloc (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).alloc ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::try_alloc()
+ */
+void*
+os_mempool_try_alloc (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).try_alloc ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::timed_alloc()
+ */
+void*
+os_mempool_timed_alloc (os_mempool_t* mempool, os_clock_duration_t timeout)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).timed_alloc (timeout);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::free()
+ */
+os_result_t
+os_mempool_free (os_mempool_t* mempool, void* block)
+{
+  assert (mempool != nullptr);
+  return (os_result_t) (reinterpret_cast<memory_pool&> (*mempool)).free (block);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::capacity()
+ */
+size_t
+os_mempool_get_capacity (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).capacity ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::count()
+ */
+size_t
+os_mempool_get_count (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).count ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::block_size()
+ */
+size_t
+os_mempool_get_block_size (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).block_size ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::empty()
+ */
+bool
+os_mempool_is_empty (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).empty ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::full()
+ */
+bool
+os_mempool_is_full (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (reinterpret_cast<memory_pool&> (*mempool)).full ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::reset()
+ */
+os_result_t
+os_mempool_reset (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (os_result_t) (reinterpret_cast<memory_pool&> (*mempool)).reset ();
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::memory_pool::pool()
+ */
+void*
+os_mempool_get_pool (os_mempool_t* mempool)
+{
+  assert (mempool != nullptr);
+  return (void*) (reinterpret_cast<memory_pool&> (*mempool)).pool ();
+}
+
+// --------------------------------------------------------------------------
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::attributes
+ */
+void
+os_mqueue_attr_init (os_mqueue_attr_t* attr)
+{
+  assert (attr != nullptr);
+  new (attr) message_queue::attributes ();
+}
+
+/**
+ * @details
+ *
+ * @note Must be paired with `os_mqueue_destruct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue
+ */
+void
+os_mqueue_construct (os_mqueue_t* mqueue, const char* name, size_t msgs,
+                     size_t msg_size_bytes, const os_mqueue_attr_t* attr)
+{
+  assert (mqueue != nullptr);
+  if (attr == nullptr)
+    {
+      attr = (const os_mqueue_attr_t*) &message_queue::initializer;
+    }
+  new (mqueue) message_queue (name, msgs, msg_size_bytes,
+                              (message_queue::attributes&) *attr);
+}
+
+/**
+ * @details
+ *
+ * @note Must be paired with `os_mqueue_construct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue
+ */
+void
+os_mqueue_destruct (os_mqueue_t* mqueue)
+{
+  assert (mqueue != nullptr);
+  (reinterpret_cast<message_queue&> (*mqueue)).~message_queue ();
+}
+
+/**
+ * @details
+ *
+ * Dynamically allocate the message queue object instance using the RTOS
+ * system allocator and construct it.
+ *
+ * @note Equivalent of C++ `new message_queue(...)`.
+ * @note Must be paired with `os_mqueue_delete()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue
+ */
+os_mqueue_t*
+os_mqueue_new (const char* name, size_t msgs, size_t msg_size_bytes,
+               const os_mqueue_attr_t* attr)
+{
+  if (attr == nullptr)
+    {
+      attr = (const os_mqueue_attr_t*) &message_queue::initializer;
+    }
+  return reinterpret_cast<os_mqueue_t*> (new message_queue (
+      name, msgs, msg_size_bytes, (message_queue::attributes&) *attr));
+}
+
+/**
+ * @details
+ *
+ * Destruct the message queue and deallocate the dynamically allocated
+ * space using the RTOS system allocator.
+ *
+ * @note Equivalent of C++ `delete ptr_mqueue`.
+ * @note Must be paired with `os_mqueue_new()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue
+ */
+void
+os_mqueue_delete (os_mqueue_t* mqueue)
+{
+  assert (mqueue != nullptr);
+  delete reinterpret_cast<message_queue*> (mqueue);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::name()
+ */
+const char*
+os_mqueue_get_name (os_mqueue_t* mqueue)
+{
+  assert (mqueue != nullptr);
+  return (reinterpret_cast<message_queue&> (*mqueue)).name ();
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::send()
+ */
+os_result_t
+os_mqueue_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
+                os_mqueue_prio_t mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).send (
+      msg, nbytes, mprio);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::try_send()
+ */
+os_result_t
+os_mqueue_try_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
+                    os_mqueue_prio_t mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_send (
+      msg, nbytes, mprio);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::timed_send()
+ */
+os_result_t
+os_mqueue_timed_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
+                      os_clock_duration_t timeout, os_mqueue_prio_t mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_send (
+      msg, nbytes, timeout, mprio);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::receive()
+ */
+os_result_t
+os_mqueue_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
+                   os_mqueue_prio_t* mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).receive (
+      msg, nbytes, mprio);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::try_receive()
+ */
+os_result_t
+os_mqueue_try_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
+                       os_mqueue_prio_t* mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_receive (
+      msg, nbytes, mprio);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::timed_receive()
+ */
+os_result_t
+os_mqueue_timed_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
+                         os_clock_duration_t timeout, os_mqueue_prio_t* mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_receive (
+      msg, nbytes, timeout, mprio);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::send_many()
+ */
+os_result_t
+os_mqueue_send_many (os_mqueue_t* mqueue, const void* msgs, size_t nmsgs,
+                     size_t* sent, os_mqueue_prio_t mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).send_many (
+      msgs, nmsgs, sent, mprio);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::try_send_many()
+ */
+os_result_t
+os_mqueue_try_send_many (os_mqueue_t* mqueue, const void* msgs, size_t nmsgs,
+                         size_t* sent, os_mqueue_prio_t mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_send_many (
+      msgs, nmsgs, sent, mprio);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::timed_send_many()
+ */
+os_result_t
+os_mqueue_timed_send_many (os_mqueue_t* mqueue, const void* msgs, size_t nmsgs,
+                           size_t* sent, os_clock_duration_t timeout,
+                           os_mqueue_prio_t mprio)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_send_many (
+      msgs, nmsgs, sent, timeout, mprio);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::receive_many()
+ */
+os_result_t
+os_mqueue_receive_many (os_mqueue_t* mqueue, void* msgs, size_t max_msgs,
+                        size_t* received, os_mqueue_prio_t* mprios)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).receive_many (
+      msgs, max_msgs, received, mprios);
+}
+
+/**
+ * @details
+ *
+ * @note Can be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::try_receive_many()
+ */
+os_result_t
+os_mqueue_try_receive_many (os_mqueue_t* mqueue, void* msgs, size_t max_msgs,
+                            size_t* received, os_mqueue_prio_t* mprios)
+{
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_receive_many (
+      msgs, max_msgs, received, mprios);
+}
+
+/**
+ * @details
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
+ *
+ * @par For the complete definition, see
+ *  @ref os::rtos::message_queue::timed_receive_many()
+ */
+os_result_t
+os_mqueue_timed_receive_many (os_mqueue_t* mqueue, void* msgs, size_t max_msgs,
+                              size_t* received, os_clock_duration_t timeout,
+                              os_mqueue_prio_t* mprios)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).name ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_receive_many (
+      msgs, max_msgs, received, timeout, mprios);
 }
 
 /**
@@ -2593,13 +3523,14 @@ os_mempool_get_name (os_mempool_t* mempool)
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::alloc()
+ *  @ref os::rtos::message_queue::loan()
  */
-void*
-os_mempool_alloc (os_mempool_t* mempool)
+os_result_t
+os_mqueue_loan (os_mqueue_t* mqueue, void** msg)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).alloc ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).loan (
+      msg);
 }
 
 /**
@@ -2608,13 +3539,14 @@ os_mempool_alloc (os_mempool_t* mempool)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::try_alloc()
+ *  @ref os::rtos::message_queue::try_loan()
  */
-void*
-os_mempool_try_alloc (os_mempool_t* mempool)
+os_result_t
+os_mqueue_try_loan (os_mqueue_t* mqueue, void** msg)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).try_alloc ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_loan (
+      msg);
 }
 
 /**
@@ -2623,13 +3555,15 @@ os_mempool_try_alloc (os_mempool_t* mempool)
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::timed_alloc()
+ *  @ref os::rtos::message_queue::timed_loan()
  */
-void*
-os_mempool_timed_alloc (os_mempool_t* mempool, os_clock_duration_t timeout)
+os_result_t
+os_mqueue_timed_loan (os_mqueue_t* mqueue, void** msg,
+                      os_clock_duration_t timeout)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).timed_alloc (timeout);
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_loan (
+      msg, timeout);
 }
 
 /**
@@ -2638,28 +3572,30 @@ os_mempool_timed_alloc (os_mempool_t* mempool, os_clock_duration_t timeout)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::free()
+ *  @ref os::rtos::message_queue::commit()
  */
 os_result_t
-os_mempool_free (os_mempool_t* mempool, void* block)
+os_mqueue_commit (os_mqueue_t* mqueue, void* msg, os_mqueue_prio_t mprio)
 {
-  assert (mempool != nullptr);
-  return (os_result_t) (reinterpret_cast<memory_pool&> (*mempool)).free (block);
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).commit (
+      msg, mprio);
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::capacity()
+ *  @ref os::rtos::message_queue::acquire()
  */
-size_t
-os_mempool_get_capacity (os_mempool_t* mempool)
+os_result_t
+os_mqueue_acquire (os_mqueue_t* mqueue, void** msg, os_mqueue_prio_t* mprio)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).capacity ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).acquire (
+      msg, mprio);
 }
 
 /**
@@ -2668,28 +3604,32 @@ os_mempool_get_capacity (os_mempool_t* mempool)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::count()
+ *  @ref os::rtos::message_queue::try_acquire()
  */
-size_t
-os_mempool_get_count (os_mempool_t* mempool)
+os_result_t
+os_mqueue_try_acquire (os_mqueue_t* mqueue, void** msg,
+                       os_mqueue_prio_t* mprio)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).count ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_acquire (
+      msg, mprio);
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::block_size()
+ *  @ref os::rtos::message_queue::timed_acquire()
  */
-size_t
-os_mempool_get_block_size (os_mempool_t* mempool)
+os_result_t
+os_mqueue_timed_acquire (os_mqueue_t* mqueue, void** msg,
+                         os_clock_duration_t timeout, os_mqueue_prio_t* mprio)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).block_size ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_acquire (
+      msg, timeout, mprio);
 }
 
 /**
@@ -2698,13 +3638,14 @@ os_mempool_get_block_size (os_mempool_t* mempool)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::empty()
+ *  @ref os::rtos::message_queue::release()
  */
-bool
-os_mempool_is_empty (os_mempool_t* mempool)
+os_result_t
+os_mqueue_release (os_mqueue_t* mqueue, void* msg)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).empty ();
+  assert (mqueue != nullptr);
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).release (
+      msg);
 }
 
 /**
@@ -2713,28 +3654,28 @@ os_mempool_is_empty (os_mempool_t* mempool)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::full()
+ *  @ref os::rtos::message_queue::length()
  */
-bool
-os_mempool_is_full (os_mempool_t* mempool)
+size_t
+os_mqueue_get_length (os_mqueue_t* mqueue)
 {
-  assert (mempool != nullptr);
-  return (reinterpret_cast<memory_pool&> (*mempool)).full ();
+  assert (mqueue != nullptr);
+  return (reinterpret_cast<message_queue&> (*mqueue)).length ();
 }
 
 /**
  * @details
  *
- * @warning Cannot be invoked from Interrupt Service Routines.
+ * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::reset()
+ *  @ref os::rtos::message_queue::capacity()
  */
-os_result_t
-os_mempool_reset (os_mempool_t* mempool)
+size_t
+os_mqueue_get_capacity (os_mqueue_t* mqueue)
 {
-  assert (mempool != nullptr);
-  return (os_result_t) (reinterpret_cast<memory_pool&> (*mempool)).reset ();
+  assert (mqueue != nullptr);
+  return (reinterpret_cast<message_queue&> (*mqueue)).capacity ();
 }
 
 /**
@@ -2743,149 +3684,125 @@ os_mempool_reset (os_mempool_t* mempool)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::memory_pool::pool()
+ *  @ref os::rtos::message_queue::msg_size()
  */
-void*
-os_mempool_get_pool (os_mempool_t* mempool)
+size_t
+os_mqueue_get_msg_size (os_mqueue_t* mqueue)
 {
-  assert (mempool != nullptr);
-  return (void*) (reinterpret_cast<memory_pool&> (*mempool)).pool ();
+  assert (mqueue != nullptr);
+  return (reinterpret_cast<message_queue&> (*mqueue)).msg_size ();
 }
 
-// --------------------------------------------------------------------------
-
 /**
  * @details
  *
- * @warning Cannot be invoked from Interrupt Service Routines.
+ * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::attributes
+ *  @ref os::rtos::message_queue::empty()
  */
-void
-os_mqueue_attr_init (os_mqueue_attr_t* attr)
+bool
+os_mqueue_is_empty (os_mqueue_t* mqueue)
 {
-  assert (attr != nullptr);
-  new (attr) message_queue::attributes ();
+  assert (mqueue != nullptr);
+  return (reinterpret_cast<message_queue&> (*mqueue)).empty ();
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_mqueue_destruct()`.
- *
- * @warning Cannot be invoked from Interrupt Service Routines.
+ * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue
+ *  @ref os::rtos::message_queue::full()
  */
-void
-os_mqueue_construct (os_mqueue_t* mqueue, const char* name, size_t msgs,
-                     size_t msg_size_bytes, const os_mqueue_attr_t* attr)
+bool
+os_mqueue_is_full (os_mqueue_t* mqueue)
 {
   assert (mqueue != nullptr);
-  if (attr == nullptr)
-    {
-      attr = (const os_mqueue_attr_t*) &message_queue::initializer;
-    }
-  new (mqueue) message_queue (name, msgs, msg_size_bytes,
-                              (message_queue::attributes&) *attr);
+  return (reinterpret_cast<message_queue&> (*mqueue)).full ();
 }
 
 /**
  * @details
  *
- * @note Must be paired with `os_mqueue_construct()`.
- *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue
+ *  @ref os::rtos::message_queue::reset()
  */
-void
-os_mqueue_destruct (os_mqueue_t* mqueue)
+os_result_t
+os_mqueue_reset (os_mqueue_t* mqueue)
 {
   assert (mqueue != nullptr);
-  (reinterpret_cast<message_queue&> (*mqueue)).~message_queue ();
+  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).reset ();
 }
 
+// ----------------------------------------------------------------------------
+
 /**
  * @details
  *
- * Dynamically allocate the message queue object instance using the RTOS
- * system allocator and construct it.
- *
- * @note Equivalent of C++ `new message_queue(...)`.
- * @note Must be paired with `os_mqueue_delete()`.
- *
- * @warning Cannot be invoked from Interrupt Service Routines.
- *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue
+ *  @ref os::rtos::mpmc_queue_base::compute_storage_size_bytes()
  */
-os_mqueue_t*
-os_mqueue_new (const char* name, size_t msgs, size_t msg_size_bytes,
-               const os_mqueue_attr_t* attr)
+size_t
+os_mpmc_queue_compute_storage_size (size_t capacity, size_t elem_size_bytes)
 {
-  if (attr == nullptr)
-    {
-      attr = (const os_mqueue_attr_t*) &message_queue::initializer;
-    }
-  return reinterpret_cast<os_mqueue_t*> (new message_queue (
-      name, msgs, msg_size_bytes, (message_queue::attributes&) *attr));
+  return mpmc_queue_base::compute_storage_size_bytes (capacity,
+                                                      elem_size_bytes);
 }
 
 /**
  * @details
  *
- * Destruct the message queue and deallocate the dynamically allocated
- * space using the RTOS system allocator.
- *
- * @note Equivalent of C++ `delete ptr_mqueue`.
- * @note Must be paired with `os_mqueue_new()`.
+ * @note Must be paired with `os_mpmc_queue_destruct()`.
  *
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue
+ *  @ref os::rtos::mpmc_queue_base
  */
 void
-os_mqueue_delete (os_mqueue_t* mqueue)
+os_mpmc_queue_construct (os_mpmc_queue_t* queue, const char* name,
+                         size_t capacity, size_t elem_size_bytes,
+                         void* storage, size_t storage_size_bytes)
 {
-  assert (mqueue != nullptr);
-  delete reinterpret_cast<message_queue*> (mqueue);
+  assert (queue != nullptr);
+  new (queue) mpmc_queue_base (name, capacity, elem_size_bytes, storage,
+                               storage_size_bytes);
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @note Must be paired with `os_mpmc_queue_construct()`.
+ *
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::name()
+ *  @ref os::rtos::mpmc_queue_base
  */
-const char*
-os_mqueue_get_name (os_mqueue_t* mqueue)
+void
+os_mpmc_queue_destruct (os_mpmc_queue_t* queue)
 {
-  assert (mqueue != nullptr);
-  return (reinterpret_cast<message_queue&> (*mqueue)).name ();
+  assert (queue != nullptr);
+  (reinterpret_cast<mpmc_queue_base&> (*queue)).~mpmc_queue_base ();
 }
 
 /**
  * @details
  *
- * @warning Cannot be invoked from Interrupt Service Routines.
+ * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::send()
+ *  @ref os::rtos::mpmc_queue_base
  */
-os_result_t
-os_mqueue_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
-                os_mqueue_prio_t mprio)
+const char*
+os_mpmc_queue_get_name (os_mpmc_queue_t* queue)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).send (
-      msg, nbytes, mprio);
+  assert (queue != nullptr);
+  return (reinterpret_cast<mpmc_queue_base&> (*queue)).name ();
 }
 
 /**
@@ -2894,15 +3811,13 @@ os_mqueue_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::try_send()
+ *  @ref os::rtos::mpmc_queue_base::try_push()
  */
 os_result_t
-os_mqueue_try_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
-                    os_mqueue_prio_t mprio)
+os_mpmc_queue_try_push (os_mpmc_queue_t* queue, const void* elem)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_send (
-      msg, nbytes, mprio);
+  assert (queue != nullptr);
+  return (os_result_t) (reinterpret_cast<mpmc_queue_base&> (*queue)).try_push (elem);
 }
 
 /**
@@ -2911,15 +3826,13 @@ os_mqueue_try_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::timed_send()
+ *  @ref os::rtos::mpmc_queue_base::push()
  */
 os_result_t
-os_mqueue_timed_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
-                      os_clock_duration_t timeout, os_mqueue_prio_t mprio)
+os_mpmc_queue_push (os_mpmc_queue_t* queue, const void* elem)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_send (
-      msg, nbytes, timeout, mprio);
+  assert (queue != nullptr);
+  return (os_result_t) (reinterpret_cast<mpmc_queue_base&> (*queue)).push (elem);
 }
 
 /**
@@ -2928,15 +3841,14 @@ os_mqueue_timed_send (os_mqueue_t* mqueue, const void* msg, size_t nbytes,
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::receive()
+ *  @ref os::rtos::mpmc_queue_base::timed_push()
  */
 os_result_t
-os_mqueue_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
-                   os_mqueue_prio_t* mprio)
+os_mpmc_queue_timed_push (os_mpmc_queue_t* queue, const void* elem,
+                          os_clock_duration_t timeout)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).receive (
-      msg, nbytes, mprio);
+  assert (queue != nullptr);
+  return (os_result_t) (reinterpret_cast<mpmc_queue_base&> (*queue)).timed_push (elem, timeout);
 }
 
 /**
@@ -2945,15 +3857,13 @@ os_mqueue_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::try_receive()
+ *  @ref os::rtos::mpmc_queue_base::try_pop()
  */
 os_result_t
-os_mqueue_try_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
-                       os_mqueue_prio_t* mprio)
+os_mpmc_queue_try_pop (os_mpmc_queue_t* queue, void* elem)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).try_receive (
-      msg, nbytes, mprio);
+  assert (queue != nullptr);
+  return (os_result_t) (reinterpret_cast<mpmc_queue_base&> (*queue)).try_pop (elem);
 }
 
 /**
@@ -2962,30 +3872,29 @@ os_mqueue_try_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
  * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::timed_receive()
+ *  @ref os::rtos::mpmc_queue_base::pop()
  */
 os_result_t
-os_mqueue_timed_receive (os_mqueue_t* mqueue, void* msg, size_t nbytes,
-                         os_clock_duration_t timeout, os_mqueue_prio_t* mprio)
+os_mpmc_queue_pop (os_mpmc_queue_t* queue, void* elem)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).timed_receive (
-      msg, nbytes, timeout, mprio);
+  assert (queue != nullptr);
+  return (os_result_t) (reinterpret_cast<mpmc_queue_base&> (*queue)).pop (elem);
 }
 
 /**
  * @details
  *
- * @note Can be invoked from Interrupt Service Routines.
+ * @warning Cannot be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::length()
+ *  @ref os::rtos::mpmc_queue_base::timed_pop()
  */
-size_t
-os_mqueue_get_length (os_mqueue_t* mqueue)
+os_result_t
+os_mpmc_queue_timed_pop (os_mpmc_queue_t* queue, void* elem,
+                         os_clock_duration_t timeout)
 {
-  assert (mqueue != nullptr);
-  return (reinterpret_cast<message_queue&> (*mqueue)).length ();
+  assert (queue != nullptr);
+  return (os_result_t) (reinterpret_cast<mpmc_queue_base&> (*queue)).timed_pop (elem, timeout);
 }
 
 /**
@@ -2994,13 +3903,13 @@ os_mqueue_get_length (os_mqueue_t* mqueue)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::capacity()
+ *  @ref os::rtos::mpmc_queue_base::length()
  */
 size_t
-os_mqueue_get_capacity (os_mqueue_t* mqueue)
+os_mpmc_queue_get_length (os_mpmc_queue_t* queue)
 {
-  assert (mqueue != nullptr);
-  return (reinterpret_cast<message_queue&> (*mqueue)).capacity ();
+  assert (queue != nullptr);
+  return (reinterpret_cast<mpmc_queue_base&> (*queue)).length ();
 }
 
 /**
@@ -3009,13 +3918,13 @@ os_mqueue_get_capacity (os_mqueue_t* mqueue)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::msg_size()
+ *  @ref os::rtos::mpmc_queue_base::capacity()
  */
 size_t
-os_mqueue_get_msg_size (os_mqueue_t* mqueue)
+os_mpmc_queue_get_capacity (os_mpmc_queue_t* queue)
 {
-  assert (mqueue != nullptr);
-  return (reinterpret_cast<message_queue&> (*mqueue)).msg_size ();
+  assert (queue != nullptr);
+  return (reinterpret_cast<mpmc_queue_base&> (*queue)).capacity ();
 }
 
 /**
@@ -3024,13 +3933,13 @@ os_mqueue_get_msg_size (os_mqueue_t* mqueue)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::empty()
+ *  @ref os::rtos::mpmc_queue_base::empty()
  */
 bool
-os_mqueue_is_empty (os_mqueue_t* mqueue)
+os_mpmc_queue_is_empty (os_mpmc_queue_t* queue)
 {
-  assert (mqueue != nullptr);
-  return (reinterpret_cast<message_queue&> (*mqueue)).empty ();
+  assert (queue != nullptr);
+  return (reinterpret_cast<mpmc_queue_base&> (*queue)).empty ();
 }
 
 /**
@@ -3039,28 +3948,13 @@ os_mqueue_is_empty (os_mqueue_t* mqueue)
  * @note Can be invoked from Interrupt Service Routines.
  *
  * @par For the complete definition, see
- *  @ref os::rtos::message_queue::full()
+ *  @ref os::rtos::mpmc_queue_base::full()
  */
 bool
-os_mqueue_is_full (os_mqueue_t* mqueue)
-{
-  assert (mqueue != nullptr);
-  return (reinterpret_cast<message_queue&> (*mqueue)).full ();
-}
-
-/**
- * @details
- *
- * @warning Cannot be invoked from Interrupt Service Routines.
- *
- * @par For the complete definition, see
- *  @ref os::rtos::message_queue::reset()
- */
-os_result_t
-os_mqueue_reset (os_mqueue_t* mqueue)
+os_mpmc_queue_is_full (os_mpmc_queue_t* queue)
 {
-  assert (mqueue != nullptr);
-  return (os_result_t) (reinterpret_cast<message_queue&> (*mqueue)).reset ();
+  assert (queue != nullptr);
+  return (reinterpret_cast<mpmc_queue_base&> (*queue)).full ();
 }
 
 // --------------------------------------------------------------------------
@@ -27,6 +27,8 @@
 
 #include <cmsis-plus/rtos/os.h>
 
+#include <limits>
+
 // ----------------------------------------------------------------------------
 
 using namespace os;
@@ -34,6 +36,13 @@ using namespace os::rtos;
 
 // ----------------------------------------------------------------------------
 
+#if !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER)
+
+// Count down the system clock ticks in a second, to simulate an RTC driver.
+static uint32_t rtc_ticks = clock_systick::frequency_hz;
+
+#endif /* !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER) */
+
 /**
  * @details
  * Must be called from the physical interrupt handler.
@@ -55,12 +64,21 @@ os_systick_handler (void)
   trace::putchar ('.');
 #endif
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+  evtrace::record_event (evtrace::event::clock_tick, &sysclock);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
     {
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
 
       sysclock.internal_increment_count ();
       hrclock.internal_increment_count ();
+
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) \
+  && !defined(OS_USE_RTOS_PORT_SCHEDULER)
+      scheduler::internal_check_quantum ();
+#endif
       // ----- Exit critical section ------------------------------------------
     }
   sysclock.internal_check_timestamps ();
@@ -69,11 +87,9 @@ os_systick_handler (void)
 #if !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER)
 
   // Simulate an RTC driver.
-  static uint32_t ticks = clock_systick::frequency_hz;
-
-  if (--ticks == 0)
+  if (--rtc_ticks == 0)
     {
-      ticks = clock_systick::frequency_hz;
+      rtc_ticks = clock_systick::frequency_hz;
 
       os_rtc_handler ();
     }
@@ -111,6 +127,10 @@ os_rtc_handler (void)
   trace_putchar ('!');
 #endif
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+  evtrace::record_event (evtrace::event::clock_tick, &rtclock);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
     {
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
@@ -168,12 +188,20 @@ namespace os
     clock::timestamp_t
     clock::now (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+      return steady_now ();
+
+#else
+
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
 
       // Prevent inconsistent values using the critical section.
       return steady_count_;
       // ----- Exit critical section ------------------------------------------
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
     }
 
     /**
@@ -184,12 +212,31 @@ namespace os
     clock::timestamp_t
     clock::steady_now (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+      // Prevent inconsistent values by reading again if the
+      // count was updated meanwhile; interrupts are not masked.
+      timestamp_t ts;
+      uint32_t seq;
+      do
+        {
+          seq = internal_seq_read_begin_ ();
+          ts = steady_count_;
+        }
+      while (internal_seq_read_retry_ (seq));
+
+      return ts;
+
+#else
+
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
 
       // Prevent inconsistent values using the critical section.
       return steady_count_;
       // ----- Exit critical section ------------------------------------------
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
     }
 
     /**
@@ -210,13 +257,31 @@ namespace os
       os_assert_err(!scheduler::locked (), EPERM);
 
       clock::timestamp_t timestamp = steady_now () + duration;
+      return internal_steady_sleep_until_ (timestamp);
+    }
+
+    /**
+     * @details
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    clock::sleep_until (timestamp_t timestamp)
+    {
+#if defined(OS_TRACE_RTOS_CLOCKS)
+      trace::printf ("%s()\n", __func__);
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
       for (;;)
         {
           result_t res;
           res = internal_wait_until_ (timestamp, steady_list_);
 
-          timestamp_t n = steady_now ();
-          if (n >= timestamp)
+          timestamp_t nw = now ();
+          if (nw >= timestamp)
             {
               return ETIMEDOUT;
             }
@@ -240,22 +305,38 @@ namespace os
      * @warning Cannot be invoked from Interrupt Service Routines.
      */
     result_t
-    clock::sleep_until (timestamp_t timestamp)
+    clock::wait_for (duration_t timeout)
     {
 #if defined(OS_TRACE_RTOS_CLOCKS)
-      trace::printf ("%s()\n", __func__);
+      trace::printf ("%s(%u)\n", __func__, static_cast<unsigned int> (timeout));
 #endif
 
       os_assert_err(!interrupts::in_handler_mode (), EPERM);
       os_assert_err(!scheduler::locked (), EPERM);
 
+      clock::timestamp_t timestamp = steady_now () + timeout;
+
+      return internal_steady_wait_until_ (timestamp);
+    }
+
+    /**
+     * @cond ignore
+     */
+
+    /*
+     * Internal function.
+     * Shared by the `sleep_for()` overloads.
+     */
+    result_t
+    clock::internal_steady_sleep_until_ (timestamp_t timestamp)
+    {
       for (;;)
         {
           result_t res;
           res = internal_wait_until_ (timestamp, steady_list_);
 
-          timestamp_t nw = now ();
-          if (nw >= timestamp)
+          timestamp_t n = steady_now ();
+          if (n >= timestamp)
             {
               return ETIMEDOUT;
             }
@@ -273,23 +354,13 @@ namespace os
       return ENOTRECOVERABLE;
     }
 
-    /**
-     * @details
-     *
-     * @warning Cannot be invoked from Interrupt Service Routines.
+    /*
+     * Internal function.
+     * Shared by the `wait_for()` overloads.
      */
     result_t
-    clock::wait_for (duration_t timeout)
+    clock::internal_steady_wait_until_ (timestamp_t timestamp)
     {
-#if defined(OS_TRACE_RTOS_CLOCKS)
-      trace::printf ("%s(%u)\n", __func__, static_cast<unsigned int> (timeout));
-#endif
-
-      os_assert_err(!interrupts::in_handler_mode (), EPERM);
-      os_assert_err(!scheduler::locked (), EPERM);
-
-      clock::timestamp_t timestamp = steady_now () + timeout;
-
       result_t res;
       res = internal_wait_until_ (timestamp, steady_list_);
 
@@ -307,6 +378,63 @@ namespace os
       return res;
     }
 
+    /**
+     * @endcond
+     */
+
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+
+    /**
+     * @details
+     * The wake-up is moved later, at most by _slack_, to a time stamp
+     * shared with other deadlines, see `clock::coalesce()`;
+     * it is never earlier than the requested duration.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    clock::sleep_for (duration_t duration, duration_t slack)
+    {
+#if defined(OS_TRACE_RTOS_CLOCKS)
+      trace::printf ("%s(%u,%u) %p %s\n", __func__,
+                     static_cast<unsigned int> (duration),
+                     static_cast<unsigned int> (slack),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      clock::timestamp_t timestamp = coalesce (steady_now () + duration,
+                                               slack);
+      return internal_steady_sleep_until_ (timestamp);
+    }
+
+    /**
+     * @details
+     * The timeout is moved later, at most by _slack_, to a time stamp
+     * shared with other deadlines, see `clock::coalesce()`.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    clock::wait_for (duration_t timeout, duration_t slack)
+    {
+#if defined(OS_TRACE_RTOS_CLOCKS)
+      trace::printf ("%s(%u,%u)\n", __func__, static_cast<unsigned int> (timeout),
+                     static_cast<unsigned int> (slack));
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      clock::timestamp_t timestamp = coalesce (steady_now () + timeout, slack);
+
+      return internal_steady_wait_until_ (timestamp);
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
+
     /**
      * @details
      * During deep sleep the interrupts used to count clock ticks are
@@ -324,7 +452,13 @@ namespace os
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
 
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_begin_ ();
+#endif
       steady_count_ += duration;
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_end_ ();
+#endif
       return steady_count_;
       // ----- Exit critical section ------------------------------------------
     }
@@ -410,6 +544,25 @@ namespace os
     clock::timestamp_t
     adjustable_clock::now (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+      // The offset is updated under the same sequence counter.
+      timestamp_t ts;
+      uint32_t seq;
+      do
+        {
+          seq = internal_seq_read_begin_ ();
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+          ts = steady_count_ + offset_;
+#pragma GCC diagnostic pop
+        }
+      while (internal_seq_read_retry_ (seq));
+
+      return ts;
+
+#else
+
       // Prevent inconsistent values.
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
@@ -419,6 +572,8 @@ namespace os
       return steady_count_ + offset_;
 #pragma GCC diagnostic pop
       // ----- Exit critical section ------------------------------------------
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
     }
 
     /**
@@ -468,7 +623,24 @@ namespace os
     clock::offset_t
     adjustable_clock::offset (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+      offset_t value;
+      uint32_t seq;
+      do
+        {
+          seq = internal_seq_read_begin_ ();
+          value = offset_;
+        }
+      while (internal_seq_read_retry_ (seq));
+
+      return value;
+
+#else
+
       return offset_;
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
     }
 
     /**
@@ -484,7 +656,13 @@ namespace os
 
       offset_t tmp;
       tmp = offset_;
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_begin_ ();
+#endif
       offset_ = value;
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+      internal_seq_write_end_ ();
+#endif
 
       return tmp;
       // ----- Exit critical section ------------------------------------------
@@ -601,6 +779,135 @@ namespace os
 
 #endif /* defined(OS_USE_RTOS_PORT_CLOCK_SYSTICK_WAIT_FOR) */
 
+#if defined(OS_INCLUDE_RTOS_TICKLESS_IDLE)
+
+    /**
+     * @details
+     * Called by the idle thread, when there is nothing else to do.
+     *
+     * The earliest deadline is identified from the system clock and
+     * the high resolution clock lists, and the port is asked, via
+     * `os_rtos_idle_suppress_ticks_hook()`, to sleep with the
+     * ticks suppressed up to that deadline.
+     *
+     * On wake-up, the ticks elapsed while sleeping are credited to
+     * the clocks in one step. The tick of the deadline itself is
+     * left to the regular interrupt, which also checks the
+     * timestamps, so sleeps, timeouts and timers expire exactly
+     * as with the periodic tick.
+     *
+     * If there are too few ticks up to the deadline, or the hook
+     * does not suppress the ticks, the device waits for the next
+     * interrupt, as usual.
+     */
+    void
+    clock_systick::internal_tickless_sleep (void)
+    {
+      bool suppressed = false;
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          duration_t ticks = internal_ticks_to_deadline_ ();
+          if (ticks >= OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS)
+            {
+              uint32_t elapsed = 0;
+              suppressed = os_rtos_idle_suppress_ticks_hook (ticks, &elapsed);
+              if (suppressed && (elapsed > 0))
+                {
+                  // The pending tick is not included.
+                  assert (elapsed < ticks);
+
+#if defined(OS_TRACE_RTOS_CLOCKS)
+                  trace::printf ("clock_systick::%s() %u/%u\n", __func__,
+                                 elapsed, ticks);
+#endif
+
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+                  internal_seq_write_begin_ ();
+#endif
+                  steady_count_ += elapsed;
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+                  internal_seq_write_end_ ();
+#endif
+                  hrclock.update_for_slept_time (
+                      elapsed * port::clock_highres::cycles_per_tick ());
+
+#if !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER)
+                  // Guaranteed by the deadline not to reach zero.
+                  rtc_ticks -= elapsed;
+#endif /* !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER) */
+                }
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      if (!suppressed)
+        {
+          port::scheduler::wait_for_interrupt ();
+        }
+    }
+
+    /**
+     * @details
+     * The result is the number of ticks after which the regular
+     * interrupt must be processed, to check the earliest timestamp
+     * of the system clock and of the high resolution clock.
+     *
+     * When the RTC is simulated from the system clock, the sleep
+     * is also limited to the end of the current second.
+     *
+     * Must be called in a critical section.
+     */
+    clock::duration_t
+    clock_systick::internal_ticks_to_deadline_ (void)
+    {
+      duration_t ticks = std::numeric_limits<duration_t>::max ();
+
+      if (!steady_list_.empty ())
+        {
+          timestamp_t ts = steady_list_.head ()->timestamp;
+          if (ts <= steady_count_)
+            {
+              return 0;
+            }
+          if ((ts - steady_count_) < ticks)
+            {
+              ticks = static_cast<duration_t> (ts - steady_count_);
+            }
+        }
+
+      internal::clock_timestamps_list& hr_list = hrclock.steady_list ();
+      if (!hr_list.empty ())
+        {
+          timestamp_t ts = hr_list.head ()->timestamp;
+          timestamp_t nw = hrclock.steady_now ();
+          if (ts <= nw)
+            {
+              return 0;
+            }
+          // Round up to the tick that reaches the timestamp.
+          uint32_t cpt = port::clock_highres::cycles_per_tick ();
+          timestamp_t hr_ticks = (ts - nw + cpt - 1) / cpt;
+          if (hr_ticks < ticks)
+            {
+              ticks = static_cast<duration_t> (hr_ticks);
+            }
+        }
+
+#if !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER)
+      if (rtc_ticks < ticks)
+        {
+          ticks = rtc_ticks;
+        }
+#endif /* !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER) */
+
+      return ticks;
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_TICKLESS_IDLE) */
+
     // ========================================================================
 
     /**
@@ -748,11 +1055,30 @@ namespace os
     clock::timestamp_t
     clock_highres::now (void)
     {
+#if defined(OS_USE_RTOS_CLOCK_SEQLOCK)
+
+      // If the tick interrupt occurs between reading the count and
+      // the cycles, both are read again.
+      timestamp_t ts;
+      uint32_t seq;
+      do
+        {
+          seq = internal_seq_read_begin_ ();
+          ts = steady_count_ + port::clock_highres::cycles_since_tick ();
+        }
+      while (internal_seq_read_retry_ (seq));
+
+      return ts;
+
+#else
+
       // ----- Enter critical section -----------------------------------------
       interrupts::critical_section ics;
 
       return steady_count_ + port::clock_highres::cycles_since_tick ();
       // ----- Exit critical section ------------------------------------------
+
+#endif /* defined(OS_USE_RTOS_CLOCK_SEQLOCK) */
     }
 
   // --------------------------------------------------------------------------
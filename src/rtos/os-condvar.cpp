@@ -323,6 +323,12 @@ namespace os
      * have no effect if there are no threads currently
      * blocked on this condition variable.
      *
+     * If the mutex of the unblocked thread is owned by the thread
+     * calling `signal()`, the unblocked thread is not resumed
+     * immediately, only to block again on the mutex, but is moved
+     * to the mutex waiting list (wait morphing), and is resumed
+     * by `mutex::unlock()`.
+     *
      * @warning Cannot be invoked from Interrupt Service Routines.
      *
      * @par POSIX compatibility
@@ -339,7 +345,7 @@ namespace os
 
       os_assert_err(!interrupts::in_handler_mode (), EPERM);
 
-      list_.resume_one ();
+      internal_wake_ (false);
 
       return result::ok;
     }
@@ -375,6 +381,12 @@ namespace os
      * have no effect if there are no threads currently
      * blocked on this condition variable.
      *
+     * Threads waiting with a mutex owned by the thread calling
+     * `broadcast()` are moved to the mutex waiting list
+     * (wait morphing), instead of being all resumed only to block
+     * again on the mutex; each of them is resumed exactly once,
+     * by `mutex::unlock()`, when it can acquire the mutex.
+     *
      * @par Application usage
      * The `broadcast()` function is used whenever
      * the shared-variable state has been changed in a way that more
@@ -409,13 +421,72 @@ namespace os
       os_assert_err(!interrupts::in_handler_mode (), EPERM);
 
       // Wake-up all threads, if any.
-      // Need not be inside the critical section,
-      // the list is protected by inner `resume_one()`.
-      list_.resume_all ();
+      internal_wake_ (true);
 
       return result::ok;
     }
 
+    /*
+     * Internal function.
+     *
+     * Wait morphing: if the mutex used by a waiting thread is owned
+     * by the signalling thread, the waiting thread would be resumed
+     * only to block again on the mutex. Instead, its node is moved
+     * directly to the mutex waiting list, and the thread is resumed
+     * once, by `mutex::unlock()`, when it can acquire the mutex.
+     * The other threads are resumed, to contend for their mutex.
+     */
+    void
+    condition_variable::internal_wake_ (bool all)
+    {
+      internal::waiting_threads_list resumed;
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          for (;;)
+            {
+              internal::waiting_condvar_node* node;
+                {
+                  // ----- Enter critical section -----------------------------
+                  interrupts::critical_section ics;
+
+                  if (list_.empty ())
+                    {
+                      break;
+                    }
+
+                  node =
+                      static_cast<internal::waiting_condvar_node*> (const_cast<internal::waiting_thread_node*> (list_.head ()));
+                  node->unlink ();
+                  node->signalled_ = true;
+                  // ----- Exit critical section ------------------------------
+                }
+
+#if !defined(OS_USE_RTOS_PORT_MUTEX)
+              if (node->thread_->state () == thread::state::destroyed
+                  || !node->mutex_->internal_morph_ (*node))
+#endif
+                {
+                  // ----- Enter critical section -----------------------------
+                  interrupts::critical_section ics;
+
+                  resumed.link (*node);
+                  // ----- Exit critical section ------------------------------
+                }
+
+              if (!all)
+                {
+                  break;
+                }
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      // The threads that could not be moved to the mutex list.
+      resumed.resume_all ();
+    }
+
     /**
      * @details
      * Block on a condition variable. The application shall ensure
@@ -513,33 +584,58 @@ namespace os
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_condvar_node node
+        { crt_thread, mutex };
 
-      // TODO: validate
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Add this thread to the condition variable waiting list
+          // while still holding the mutex, so that no signal sent
+          // after the mutex is released can be missed.
+          list_.link (node);
+          node.thread_->waiting_node_ = &node;
+          // ----- Exit critical section --------------------------------------
+        }
 
       result_t res;
       res = mutex.unlock ();
 
       if (res != result::ok)
         {
+          scheduler::internal_unlink_node (node);
           return res;
         }
 
         {
-          // Add this thread to the condition variable waiting list.
-          list_.link (node);
-          node.thread_->waiting_node_ = &node;
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Suspend, unless already resumed by signal()/broadcast().
+          // If moved to the mutex list, the thread is resumed by
+          // mutex::unlock().
+          if (!node.unlinked ())
+            {
+              // Remove this thread from the ready list, if there.
+              port::this_thread::prepare_suspend ();
+
+              crt_thread.state_ = thread::state::suspended;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+              evtrace::record_event (evtrace::event::wait_begin, &list_);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+            }
+          // ----- Exit critical section --------------------------------------
+        }
 
-          res = mutex.lock ();
+      port::scheduler::reschedule ();
 
-          // Remove the thread from the node waiting list,
-          // if not already removed.
-          node.thread_->waiting_node_ = nullptr;
-          node.unlink ();
-        }
+      // Remove the thread from the condition variable or the mutex
+      // waiting list, if not already removed.
+      scheduler::internal_unlink_node (node);
 
-      return res;
+      return mutex.lock ();
     }
 
     /**
@@ -657,33 +753,106 @@ namespace os
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_condvar_node node
+        { crt_thread, mutex };
+
+#if !defined(OS_USE_RTOS_PORT_MUTEX)
+      // The timeout is measured on the mutex clock.
+      clock& clk = *mutex.clock_;
+#else
+      clock& clk = sysclock;
+#endif
+
+      internal::clock_timestamps_list& clock_list = clk.steady_list ();
+      clock::timestamp_t timeout_timestamp = clk.steady_now () + timeout;
 
-      // TODO: validate
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Add this thread to the condition variable waiting list
+          // while still holding the mutex, so that no signal sent
+          // after the mutex is released can be missed.
+          list_.link (node);
+          node.thread_->waiting_node_ = &node;
+          // ----- Exit critical section --------------------------------------
+        }
 
       result_t res;
       res = mutex.unlock ();
 
       if (res != result::ok)
         {
+          scheduler::internal_unlink_node (node);
           return res;
         }
 
         {
-          // Add this thread to the condition variable waiting list.
-          list_.link (node);
-          node.thread_->waiting_node_ = &node;
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Suspend, unless already resumed by signal()/broadcast().
+          // If moved to the mutex list, the thread is resumed by
+          // mutex::unlock() or by the timeout.
+          if (!node.unlinked ())
+            {
+              // Remove this thread from the ready list, if there.
+              port::this_thread::prepare_suspend ();
+
+              crt_thread.state_ = thread::state::suspended;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+              evtrace::record_event (evtrace::event::wait_begin, &list_);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
+              // Add this thread to the clock timeout list.
+              clock_list.link (timeout_node);
+              timeout_node.thread.clock_node_ = &timeout_node;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
 
-          res = mutex.timed_lock (timeout);
+      port::scheduler::reschedule ();
 
-          // Remove the thread from the node waiting list,
-          // if not already removed.
-          node.thread_->waiting_node_ = nullptr;
-          node.unlink ();
+      bool timed_out;
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Decide before reacquiring the mutex, which may take
+          // past the deadline: it is a timeout only if the timer
+          // fired while the thread was still waiting on the
+          // condition variable, not after it was signalled.
+          timed_out = timeout_node.unlinked () && !node.signalled_;
+
+          // Remove the thread from the condition variable or the mutex
+          // waiting list, if not already removed, and from the clock
+          // timeout list, if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+          // ----- Exit critical section --------------------------------------
         }
 
-      return res;
+      // Even after a timeout, the mutex must be reacquired.
+      res = mutex.lock ();
+      if (res != result::ok)
+        {
+          return res;
+        }
+
+      if (timed_out)
+        {
+#if defined(OS_TRACE_RTOS_CONDVAR)
+          trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__,
+                         static_cast<unsigned int> (timeout), this, name ());
+#endif
+          return ETIMEDOUT;
+        }
+
+      return result::ok;
     }
 
   // --------------------------------------------------------------------------
@@ -136,6 +136,10 @@ namespace os
 
         os_assert_err(!interrupts::in_handler_mode (), EPERM);
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+        evtrace::initialize ();
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
 #if defined(OS_USE_RTOS_PORT_SCHEDULER)
 
         return port::scheduler::initialize ();
@@ -311,6 +315,10 @@ namespace os
         node.thread_->waiting_node_ = &node;
 
         node.thread_->state_ = thread::state::suspended;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+        evtrace::record_event (evtrace::event::wait_begin, &list);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
       }
 
       void
@@ -324,6 +332,10 @@ namespace os
             // if not already removed.
             node.thread_->waiting_node_ = nullptr;
             node.unlink ();
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+            evtrace::record_event (evtrace::event::wait_end, 0u);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
             // ----- Exit critical section ------------------------------------
           }
       }
@@ -343,6 +355,10 @@ namespace os
 
         node.thread_->state_ = thread::state::suspended;
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+        evtrace::record_event (evtrace::event::wait_begin, &list);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
         // Add this thread to the clock timeout list.
         timeout_list.link (timeout_node);
         timeout_node.thread.clock_node_ = &timeout_node;
@@ -364,6 +380,10 @@ namespace os
         // if not already removed.
         node.thread_->waiting_node_ = nullptr;
         node.unlink ();
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+        evtrace::record_event (evtrace::event::wait_end, 0u);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
         // ----- Exit critical section ----------------------------------------
       }
 
@@ -396,6 +416,10 @@ namespace os
 
 #endif /* defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CPU_CYCLES) */
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+        thread* old_thread = scheduler::current_thread_;
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
         // Normally the old running thread must be re-linked to ready.
         scheduler::current_thread_->internal_relink_running_ ();
 
@@ -410,6 +434,10 @@ namespace os
         // the relink_running() will simply reschedule it,
         // otherwise the thread will be lost.
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+        evtrace::record_event (evtrace::event::thread_switch, old_thread);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
 #if defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CONTEXT_SWITCHES)
 
         // Increment global context switches.
@@ -422,6 +450,35 @@ namespace os
 
       }
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+
+      /**
+       * @details
+       * Called from the system clock interrupt, once per tick,
+       * to consume the time slice of the running thread.
+       *
+       * When it reaches zero, the next context switch
+       * moves the thread behind its peers with the same priority.
+       *
+       * Must be called in a critical section.
+       */
+      void
+      internal_check_quantum (void)
+      {
+        if (!is_started_)
+          {
+            return;
+          }
+
+        thread* th = current_thread_;
+        if ((th->quantum_ticks_ != 0) && (th->quantum_left_ != 0))
+          {
+            --th->quantum_left_;
+          }
+      }
+
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
 #endif /* !defined(OS_USE_RTOS_PORT_SCHEDULER) */
 
       namespace statistics
@@ -439,6 +496,12 @@ namespace os
 
 #endif /* defined(OS_INCLUDE_RTOS_STATISTICS_THREAD_CPU_CYCLES) */
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY)
+
+        rtos::statistics::duration_t clock_expiry_max_masked_cycles_;
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_CLOCK_EXPIRY) */
+
       } /* namespace statistics */
 
     /**
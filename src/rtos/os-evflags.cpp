@@ -265,11 +265,12 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
-      // Prepare a list node pointing to the current thread.
+      // Prepare a list node pointing to the current thread, with the
+      // expected flags, checked by raise() before waking the thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_flags_node node
+        { crt_thread, mask, mode };
 
       for (;;)
         {
@@ -304,6 +305,21 @@ namespace os
               // ----- Exit critical section ----------------------------------
             }
 
+          if (node.satisfied_)
+            {
+              // The flags were already checked (and possibly cleared)
+              // by raise(), on behalf of this thread.
+              if (oflags != nullptr)
+                {
+                  *oflags = node.raised_;
+                }
+#if defined(OS_TRACE_RTOS_EVFLAGS)
+              trace::printf ("%s(0x%X,%u) @%p %s >0x%X\n", __func__, mask,
+                             mode, this, name (), event_flags_.mask ());
+#endif
+              return result::ok;
+            }
+
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_EVFLAGS)
@@ -450,11 +466,12 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
-      // Prepare a list node pointing to the current thread.
+      // Prepare a list node pointing to the current thread, with the
+      // expected flags, checked by raise() before waking the thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_flags_node node
+        { crt_thread, mask, mode };
 
       internal::clock_timestamps_list& clock_list = clock_->steady_list ();
       clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
@@ -494,6 +511,22 @@ namespace os
           // timeout list, if not already removed by the timer.
           scheduler::internal_unlink_node (node, timeout_node);
 
+          if (node.satisfied_)
+            {
+              // The flags were already checked (and possibly cleared)
+              // by raise(), on behalf of this thread.
+              if (oflags != nullptr)
+                {
+                  *oflags = node.raised_;
+                }
+#if defined(OS_TRACE_RTOS_EVFLAGS)
+              trace::printf ("%s(0x%X,%u,%u) @%p %s >0x%X\n", __func__,
+                             mask, timeout, mode, this, name (),
+                             event_flags_.mask ());
+#endif
+              return result::ok;
+            }
+
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_EVFLAGS)
@@ -523,7 +556,10 @@ namespace os
      * @details
      * Set more bits in the thread current signal mask.
      * Use OR at bit-mask level.
-     * Wake-up all waiting threads, if any.
+     * Wake-up only the waiting threads whose conditions are now
+     * satisfied, if any, in priority order; for threads waiting with
+     * flags::mode::clear, the flags are consumed at wake time, so
+     * lower priority threads expecting the same flags remain suspended.
      *
      * @note Can be invoked from Interrupt Service Routines.
      */
@@ -545,10 +581,10 @@ namespace os
 
       result_t res = event_flags_.raise (mask, oflags);
 
-      // Wake-up all threads, if any.
+      // Wake-up the satisfied threads, if any.
       // Need not be inside the critical section,
-      // the list is protected by inner `resume_one()`.
-      list_.resume_all ();
+      // the list is protected by inner `resume_raised()`.
+      list_.resume_raised (event_flags_);
 
 #if defined(OS_TRACE_RTOS_EVFLAGS)
       trace::printf ("%s(0x%X) @%p %s >0x%X\n", __func__, mask, this, name (),
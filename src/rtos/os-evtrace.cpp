@@ -0,0 +1,441 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+
+namespace os
+{
+  namespace rtos
+  {
+    namespace evtrace
+    {
+      /**
+       * @cond ignore
+       */
+
+      ring ring_;
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @details
+       * Called by `scheduler::initialize()`; can be called later
+       * to restart recording.
+       *
+       * @warning Cannot be invoked from Interrupt Service Routines.
+       */
+      void
+      initialize (void)
+      {
+        // ----- Enter critical section ---------------------------------------
+        interrupts::critical_section ics;
+
+        ring_.magic = magic;
+        ring_.version = version;
+        ring_.record_size = sizeof(record);
+        ring_.records_count = OS_INTEGER_RTOS_EVTRACE_RECORDS;
+        ring_.clock_frequency_hz = hrclock.input_clock_frequency_hz ();
+        ring_.head = 0;
+        // ----- Exit critical section ----------------------------------------
+      }
+
+      /**
+       * @cond ignore
+       */
+
+      // Thread id used for the interrupts track.
+      static constexpr uint32_t isr_track = 0;
+
+      // Maximum number of pending wake-up flows.
+      static constexpr std::size_t max_flows = 16;
+
+      class json_writer
+      {
+      public:
+
+        json_writer (std::FILE* file) :
+            file_ (file)
+        {
+          ;
+        }
+
+        void
+        begin (void)
+        {
+          std::fputs ("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file_);
+        }
+
+        void
+        end (void)
+        {
+          std::fputs ("\n]}\n", file_);
+        }
+
+        // Start a new event object, with the common members.
+        void
+        event (const char* ph, uint32_t tid, double ts)
+        {
+          separator ();
+          std::fprintf (file_, "{\"ph\":\"%s\",\"pid\":1,\"tid\":%lu,"
+                        "\"ts\":%.3f",
+                        ph, static_cast<unsigned long> (tid), ts);
+        }
+
+        void
+        metadata (const char* what, uint32_t tid, const char* name)
+        {
+          separator ();
+          std::fprintf (file_, "{\"ph\":\"M\",\"pid\":1,\"tid\":%lu,"
+                        "\"name\":\"%s\",\"args\":{\"name\":\"",
+                        static_cast<unsigned long> (tid), what);
+          string (name);
+          std::fputs ("\"}}", file_);
+        }
+
+        void
+        member (const char* name, const char* value)
+        {
+          std::fprintf (file_, ",\"%s\":\"%s\"", name, value);
+        }
+
+        void
+        member (const char* name, unsigned long value)
+        {
+          std::fprintf (file_, ",\"%s\":%lu", name, value);
+        }
+
+        void
+        object_arg (uint32_t object)
+        {
+          std::fprintf (file_, ",\"args\":{\"object\":\"0x%08lx\"}",
+                        static_cast<unsigned long> (object));
+        }
+
+        void
+        close (void)
+        {
+          std::fputs ("}", file_);
+        }
+
+      protected:
+
+        void
+        separator (void)
+        {
+          if (!first_)
+            {
+              std::fputs (",\n", file_);
+            }
+          first_ = false;
+        }
+
+        // Names are user strings, escape what JSON requires.
+        void
+        string (const char* str)
+        {
+          for (; *str != '\0'; ++str)
+            {
+              char c = *str;
+              if (c == '"' || c == '\\')
+                {
+                  std::fputc ('\\', file_);
+                  std::fputc (c, file_);
+                }
+              else if (static_cast<unsigned char> (c) < 0x20)
+                {
+                  std::fprintf (file_, "\\u%04x", c);
+                }
+              else
+                {
+                  std::fputc (c, file_);
+                }
+            }
+        }
+
+        std::FILE* file_;
+        bool first_ = true;
+      };
+
+      static void
+      write_thread_names (json_writer& json, thread* parent)
+      {
+        for (auto&& th : scheduler::children_threads (parent))
+          {
+            json.metadata (
+                "thread_name",
+                static_cast<uint32_t> (reinterpret_cast<uintptr_t> (&th)),
+                th.name ());
+            write_thread_names (json, &th);
+          }
+      }
+
+      /**
+       * @endcond
+       */
+
+      /**
+       * @details
+       * The timeline has one track per thread, named after the
+       * live threads, with slices for the running intervals, and an
+       * additional track for interrupts, clock ticks and timers.
+       *
+       * Thread resumes are shown as flow arrows, from the
+       * thread or interrupt that resumed the thread to the moment
+       * the resumed thread starts running.
+       *
+       * The output can be opened in `chrome://tracing` or in the
+       * Perfetto UI. It works the same in synthetic (host)
+       * builds, where _file_ can be any `fopen()` stream.
+       *
+       * The records are exported in the ring order, like with
+       * `scripts/evtrace-decode.py --json`; the two outputs differ
+       * only in the thread names, which here are those of the
+       * live threads.
+       *
+       * Records written while exporting may overwrite older ones;
+       * for consistent results, disable the trace or lock the
+       * scheduler.
+       */
+      result_t
+      write_json (std::FILE* file)
+      {
+        os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+        json_writer json
+          { file };
+
+        json.begin ();
+        json.metadata ("process_name", isr_track, "µOS++");
+        json.metadata ("thread_name", isr_track, "interrupts");
+          {
+            scheduler::critical_section scs;
+
+            write_thread_names (json, nullptr);
+          }
+
+        uint32_t head = ring_.head;
+        uint32_t count = ring_.records_count;
+        uint32_t first = (head > count) ? head - count : 0;
+
+        double us_per_cycle = (ring_.clock_frequency_hz != 0) ?
+            (1e6 / ring_.clock_frequency_hz) : 1.0;
+
+        // Pending wake-up flows, by resumed thread.
+        struct
+        {
+          uint32_t thread;
+          uint32_t id;
+        } flows[max_flows] =
+          { };
+        std::size_t next_flow = 0;
+
+        uint32_t running = 0;
+        uint32_t isr_depth = 0;
+        int64_t total = 0;
+        uint32_t previous = 0;
+
+        for (uint32_t seq = first; seq != head; ++seq)
+          {
+            record r = ring_.records[seq % count];
+
+            // Extend the 32-bit time stamps, allowing small
+            // negative steps for interrupted records.
+            if (seq == first)
+              {
+                total = 0;
+              }
+            else
+              {
+                total += static_cast<int32_t> (r.timestamp - previous);
+              }
+            previous = r.timestamp;
+            double ts = static_cast<double> (total) * us_per_cycle;
+
+            switch (r.event)
+              {
+              case event::thread_switch:
+                if (running != 0 && running == r.object)
+                  {
+                    json.event ("E", running, ts);
+                    json.close ();
+                  }
+                json.event ("B", r.thread, ts);
+                json.member ("name", "running");
+                json.close ();
+                running = r.thread;
+
+                // Terminate the flow that resumed this thread.
+                for (auto&& f : flows)
+                  {
+                    if (f.thread == r.thread)
+                      {
+                        json.event ("f", r.thread, ts);
+                        json.member ("name", "wake");
+                        json.member ("cat", "wake");
+                        json.member ("id", f.id);
+                        json.member ("bp", "e");
+                        json.close ();
+                        f.thread = 0;
+                      }
+                  }
+                break;
+
+              case event::thread_resume:
+                  {
+                    uint32_t tid = (isr_depth > 0) ? isr_track : r.thread;
+                    json.event ("s", tid, ts);
+                    json.member ("name", "wake");
+                    json.member ("cat", "wake");
+                    json.member ("id", seq);
+                    json.close ();
+
+                    // One pending flow per thread, the latest resume.
+                    std::size_t ix = max_flows;
+                    for (std::size_t i = 0; i < max_flows; ++i)
+                      {
+                        if (flows[i].thread == r.object)
+                          {
+                            ix = i;
+                            break;
+                          }
+                      }
+                    if (ix == max_flows)
+                      {
+                        // Prefer a free entry.
+                        for (std::size_t i = 0; i < max_flows; ++i)
+                          {
+                            if (flows[i].thread == 0)
+                              {
+                                ix = i;
+                                break;
+                              }
+                          }
+                      }
+                    if (ix == max_flows)
+                      {
+                        // All entries hold pending flows; drop them
+                        // in turn, their arrows remain open.
+                        ix = next_flow;
+                        next_flow = (next_flow + 1) % max_flows;
+                      }
+                    flows[ix].thread = r.object;
+                    flows[ix].id = seq;
+                  }
+                break;
+
+              case event::wait_begin:
+                json.event ("i", r.thread, ts);
+                json.member ("name", "wait");
+                json.member ("s", "t");
+                json.object_arg (r.object);
+                json.close ();
+                break;
+
+              case event::wait_end:
+                json.event ("i", r.thread, ts);
+                json.member ("name", "wait-end");
+                json.member ("s", "t");
+                json.close ();
+                break;
+
+              case event::clock_tick:
+                json.event ("i", isr_track, ts);
+                json.member ("name", "tick");
+                json.member ("s", "t");
+                json.object_arg (r.object);
+                json.close ();
+                break;
+
+              case event::isr_enter:
+                json.event ("B", isr_track, ts);
+                json.member ("name", "irq");
+                std::fprintf (file, ",\"args\":{\"irq\":%lu}",
+                              static_cast<unsigned long> (r.object));
+                json.close ();
+                ++isr_depth;
+                break;
+
+              case event::isr_exit:
+                if (isr_depth > 0)
+                  {
+                    json.event ("E", isr_track, ts);
+                    json.close ();
+                    --isr_depth;
+                  }
+                break;
+
+              case event::timer_expire:
+                json.event ("i", isr_track, ts);
+                json.member ("name", "timer");
+                json.member ("s", "t");
+                json.object_arg (r.object);
+                json.close ();
+                break;
+
+              default:
+                json.event ("i", r.thread, ts);
+                if (r.event >= event::user)
+                  {
+                    std::fprintf (
+                        file, ",\"name\":\"user-%lu\"",
+                        static_cast<unsigned long> (r.event - event::user));
+                  }
+                else
+                  {
+                    // Not known to this version.
+                    std::fprintf (file, ",\"name\":\"event-%lu\"",
+                                  static_cast<unsigned long> (r.event));
+                  }
+                json.member ("s", "t");
+                json.object_arg (r.object);
+                json.close ();
+                break;
+              }
+          }
+
+        json.end ();
+
+        if (std::ferror (file) != 0)
+          {
+            return EIO;
+          }
+        return result::ok;
+      }
+
+    } /* namespace evtrace */
+  } /* namespace rtos */
+} /* namespace os */
+
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
+// ----------------------------------------------------------------------------
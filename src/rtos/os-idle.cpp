@@ -65,6 +65,45 @@ os_rtos_idle_enter_power_saving_mode_hook (void)
   return false;
 }
 
+#if defined(OS_INCLUDE_RTOS_TICKLESS_IDLE) || defined(__DOXYGEN__)
+
+/**
+ * @details
+ * The hook is called by the idle thread, in an interrupts critical
+ * section, when the earliest clock deadline is at least
+ * `OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS` ticks away.
+ *
+ * The implementation must reprogram the system clock timer to
+ * interrupt after at most `max_ticks` ticks (or the hardware limit,
+ * if lower), enter the sleep mode, and, on wake-up (either by the
+ * timer or by any other interrupt), restore the periodic tick and
+ * return via `elapsed_ticks` the number of full ticks elapsed
+ * while sleeping, not including the tick that triggers the pending
+ * interrupt, which will be processed as usual by
+ * `os_systick_handler()` when the critical section is exited.
+ *
+ * Since the hook is called with interrupts disabled, the
+ * implementation must ensure that the wake-up interrupts can end
+ * the sleep.
+ *
+ * The hook does not depend on any specific hardware, so it can
+ * be replaced by a simulated clock for tests running on a host.
+ *
+ * The default implementation does not suppress ticks and
+ * returns `false`, which makes the idle thread wait for the
+ * next interrupt, as usual.
+ */
+bool
+__attribute__((weak))
+os_rtos_idle_suppress_ticks_hook (uint32_t max_ticks __attribute__((unused)),
+                                  uint32_t* elapsed_ticks)
+{
+  *elapsed_ticks = 0;
+  return false;
+}
+
+#endif /* defined(OS_INCLUDE_RTOS_TICKLESS_IDLE) */
+
 void
 __attribute__((weak))
 os_rtos_idle_actions (void)
@@ -93,7 +132,12 @@ os_rtos_idle_actions (void)
 
   if (!os_rtos_idle_enter_power_saving_mode_hook ())
     {
+#if defined(OS_INCLUDE_RTOS_TICKLESS_IDLE)
+      // Sleep until the earliest clock deadline, without ticks.
+      sysclock.internal_tickless_sleep ();
+#else
       port::scheduler::wait_for_interrupt ();
+#endif /* defined(OS_INCLUDE_RTOS_TICKLESS_IDLE) */
     }
 }
 
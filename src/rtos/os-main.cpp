@@ -172,6 +172,10 @@ main (int argc, char* argv[])
   os_startup_create_thread_idle ();
 #endif /* !defined(OS_USE_RTOS_PORT_SCHEDULER) */
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) && !defined(OS_USE_RTOS_PORT_TIMER)
+  os_startup_create_thread_timer_daemon ();
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
   // Execution will proceed to first registered thread, possibly
   // "idle", which will immediately lower its priority,
   // and at a certain moment will reach os_main().
@@ -398,6 +398,7 @@ namespace os
 #endif
 
       assert(list_.empty ());
+      assert(sets_list_.empty ());
 
       typedef typename std::allocator_traits<allocator_type>::pointer pointer;
 
@@ -789,8 +790,10 @@ namespace os
           // ----- Exit critical section --------------------------------------
         }
 
-      // Wake-up one thread, if any.
+      // Wake-up one thread, if any, and the wait sets, which
+      // do not take the block.
       list_.resume_one ();
+      sets_list_.resume_all ();
 
       return result::ok;
     }
@@ -822,6 +825,7 @@ namespace os
       // Need not be inside the critical section,
       // the list is protected by inner `resume_one()`.
       list_.resume_all ();
+      sets_list_.resume_all ();
 
       return result::ok;
     }
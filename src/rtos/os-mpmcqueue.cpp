@@ -0,0 +1,630 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+    // ------------------------------------------------------------------------
+
+    /**
+     * @class mpmc_queue_base
+     * @details
+     * The implementation follows the bounded queue described by
+     * Dmitry Vyukov. Each cell has a sequence number; a cell at
+     * position `pos` is free for the producer which claims `pos`
+     * when its sequence is `pos`, and holds an element for the
+     * consumer which claims `pos` when its sequence is `pos + 1`.
+     * After the consumer copies the element, it sets the sequence
+     * to `pos + capacity`, freeing the cell for the next round.
+     *
+     * The positions are claimed with compare-and-swap, and the
+     * copies are done outside any critical section, so interrupt
+     * handlers can push and pop with bounded latency, and never
+     * delay other interrupts. The compare-and-swap requires
+     * LDREX/STREX, so on Cortex-M the queue needs ARMv7-M or higher.
+     *
+     * If a thread is preempted after it claimed a cell and before it
+     * published it, the following cells are not reachable until
+     * it resumes; an interrupt handler which finds the queue in this
+     * state gets `EWOULDBLOCK`, it does not spin.
+     *
+     * The blocking functions retry the non-blocking ones and link
+     * the thread to the waiting list in the same interrupts critical
+     * section, so a cell published or freed by another thread or
+     * by an interrupt handler is either seen by the retry, or it
+     * finds the waiting list not empty and resumes the thread.
+     * As everywhere else in the scheduler, this relies on a single
+     * core; the cells themselves are safe on multiple cores, but
+     * the wake-ups are not.
+     *
+     * @par Example
+     *
+     * @code{.cpp}
+     * mpmc_queue<request_t, 16> requests;
+     *
+     * void
+     * CAN_IRQHandler (void)
+     * {
+     *   request_t req = read_request ();
+     *   requests.try_push (req);
+     * }
+     *
+     * void*
+     * worker (void* args)
+     * {
+     *   request_t req;
+     *   for (;;)
+     *     {
+     *       requests.pop (req);
+     *       // Process the request.
+     *     }
+     * }
+     * @endcode
+     */
+
+    /**
+     * @details
+     * The storage must be aligned as `std::max_align_t` and
+     * must have at least `compute_storage_size_bytes (capacity,
+     * elem_size_bytes)` bytes.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    mpmc_queue_base::mpmc_queue_base (std::size_t capacity,
+                                      std::size_t elem_size_bytes,
+                                      void* storage,
+                                      std::size_t storage_size_bytes) :
+        mpmc_queue_base
+          { nullptr, capacity, elem_size_bytes, storage, storage_size_bytes }
+    {
+      ;
+    }
+
+    /**
+     * @details
+     * The storage must be aligned as `std::max_align_t` and
+     * must have at least `compute_storage_size_bytes (capacity,
+     * elem_size_bytes)` bytes.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    mpmc_queue_base::mpmc_queue_base (const char* name, std::size_t capacity,
+                                      std::size_t elem_size_bytes,
+                                      void* storage,
+                                      std::size_t storage_size_bytes) :
+        mpmc_queue_base
+          { name }
+    {
+      internal_construct_ (capacity, elem_size_bytes, storage,
+                           storage_size_bytes);
+    }
+
+    /**
+     * @cond ignore
+     */
+
+    mpmc_queue_base::mpmc_queue_base (const char* name) :
+        object_named_system
+          { name }
+    {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, this->name ());
+#endif
+
+      os_assert_throw(!interrupts::in_handler_mode (), EPERM);
+    }
+
+    void
+    mpmc_queue_base::internal_construct_ (std::size_t capacity,
+                                          std::size_t elem_size_bytes,
+                                          void* storage,
+                                          std::size_t storage_size_bytes)
+    {
+      os_assert_throw(capacity >= 2 && (capacity & (capacity - 1)) == 0,
+                      EINVAL);
+      os_assert_throw(elem_size_bytes > 0, EINVAL);
+      os_assert_throw(storage != nullptr, EINVAL);
+      os_assert_throw(
+          storage_size_bytes >= compute_storage_size_bytes (capacity, elem_size_bytes),
+          EINVAL);
+
+      storage_ = static_cast<char*> (storage);
+      mask_ = capacity - 1;
+      elem_size_bytes_ = elem_size_bytes;
+      cell_size_bytes_ = compute_cell_size_bytes (elem_size_bytes);
+
+      for (index_t i = 0; i < capacity; ++i)
+        {
+          *internal_seq_ (i) = i;
+        }
+    }
+
+    /**
+     * @endcond
+     */
+
+    /**
+     * @details
+     * It is safe to destroy a queue with no threads waiting
+     * on it; the elements still in the queue are discarded.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    mpmc_queue_base::~mpmc_queue_base ()
+    {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      assert(consumers_list_.empty ());
+      assert(producers_list_.empty ());
+    }
+
+    /**
+     * @details
+     * Claim the cell at the enqueue position, copy the element
+     * and publish it. If a consumer is waiting, wake it up.
+     *
+     * The function does not disable interrupts, unless it needs
+     * to wake up a waiting consumer.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    mpmc_queue_base::try_push (const void* elem)
+    {
+      assert(elem != nullptr);
+
+      index_t pos = __atomic_load_n (&enqueue_pos_, __ATOMIC_RELAXED);
+      index_t* seq;
+      for (;;)
+        {
+          seq = internal_seq_ (pos);
+          index_t s = __atomic_load_n (seq, __ATOMIC_ACQUIRE);
+          std::ptrdiff_t dif = static_cast<std::ptrdiff_t> (s - pos);
+          if (dif == 0)
+            {
+              // The cell is free; try to claim it. On failure,
+              // pos is updated with the current position.
+              if (__atomic_compare_exchange_n (&enqueue_pos_, &pos, pos + 1,
+                                               true, __ATOMIC_RELAXED,
+                                               __ATOMIC_RELAXED))
+                {
+                  break;
+                }
+            }
+          else if (dif < 0)
+            {
+              // The cell was not yet freed by a consumer.
+              return EWOULDBLOCK;
+            }
+          else
+            {
+              // Another producer claimed the cell.
+              pos = __atomic_load_n (&enqueue_pos_, __ATOMIC_RELAXED);
+            }
+        }
+
+      std::memcpy (reinterpret_cast<char*> (seq) + cell_header_size_bytes,
+                   elem, elem_size_bytes_);
+      __atomic_store_n (seq, pos + 1, __ATOMIC_RELEASE);
+
+      // Order the publication before the check of the waiting list;
+      // a consumer which failed to find the element is already
+      // linked, since it retries and links in a critical section.
+      __atomic_thread_fence (__ATOMIC_SEQ_CST);
+      if (!consumers_list_.empty ())
+        {
+          consumers_list_.resume_one ();
+        }
+
+      return result::ok;
+    }
+
+    /**
+     * @details
+     * If the queue is full, the thread is linked to the producers
+     * waiting list and suspended, until a consumer frees a cell.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    mpmc_queue_base::push (const void* elem)
+    {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      if (try_push (elem) == result::ok)
+        {
+          return result::ok;
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_thread_node node
+        { crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              if (try_push (elem) == result::ok)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the producers waiting list.
+              scheduler::internal_link_node (producers_list_, node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the waiting list,
+          // if not already removed by a consumer.
+          scheduler::internal_unlink_node (node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+    /**
+     * @details
+     * If the queue is full, the thread is linked to the producers
+     * waiting list and suspended, until a consumer frees a cell,
+     * or the timeout, measured with the system clock, expires.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    mpmc_queue_base::timed_push (const void* elem, clock::duration_t timeout)
+    {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+      trace::printf ("%s(%u) @%p %s\n", __func__,
+                     static_cast<unsigned int> (timeout), this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      if (try_push (elem) == result::ok)
+        {
+          return result::ok;
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_thread_node node
+        { crt_thread };
+
+      internal::clock_timestamps_list& clock_list = sysclock.steady_list ();
+      clock::timestamp_t timeout_timestamp = sysclock.steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              if (try_push (elem) == result::ok)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the producers waiting list,
+              // and the clock timeout list.
+              scheduler::internal_link_node (producers_list_, node, clock_list,
+                                             timeout_node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the waiting list,
+          // if not already removed by a consumer and from the clock
+          // timeout list, if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+              trace::printf ("%s(%u) EINTR @%p %s\n", __func__,
+                             static_cast<unsigned int> (timeout), this,
+                             name ());
+#endif
+              return EINTR;
+            }
+
+          if (sysclock.steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+              trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__,
+                             static_cast<unsigned int> (timeout), this,
+                             name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+    /**
+     * @details
+     * Claim the cell at the dequeue position, copy the element
+     * and free the cell for the next round. If a producer is
+     * waiting, wake it up.
+     *
+     * The function does not disable interrupts, unless it needs
+     * to wake up a waiting producer.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    mpmc_queue_base::try_pop (void* elem)
+    {
+      assert(elem != nullptr);
+
+      index_t pos = __atomic_load_n (&dequeue_pos_, __ATOMIC_RELAXED);
+      index_t* seq;
+      for (;;)
+        {
+          seq = internal_seq_ (pos);
+          index_t s = __atomic_load_n (seq, __ATOMIC_ACQUIRE);
+          std::ptrdiff_t dif = static_cast<std::ptrdiff_t> (s - (pos + 1));
+          if (dif == 0)
+            {
+              // The cell holds an element; try to claim it. On failure,
+              // pos is updated with the current position.
+              if (__atomic_compare_exchange_n (&dequeue_pos_, &pos, pos + 1,
+                                               true, __ATOMIC_RELAXED,
+                                               __ATOMIC_RELAXED))
+                {
+                  break;
+                }
+            }
+          else if (dif < 0)
+            {
+              // The cell was not yet published by a producer.
+              return EWOULDBLOCK;
+            }
+          else
+            {
+              // Another consumer claimed the cell.
+              pos = __atomic_load_n (&dequeue_pos_, __ATOMIC_RELAXED);
+            }
+        }
+
+      std::memcpy (elem, reinterpret_cast<char*> (seq) + cell_header_size_bytes,
+                   elem_size_bytes_);
+      __atomic_store_n (seq, pos + mask_ + 1, __ATOMIC_RELEASE);
+
+      // Order the release of the cell before the check of the waiting
+      // list; a producer which failed to find a free cell is already
+      // linked, since it retries and links in a critical section.
+      __atomic_thread_fence (__ATOMIC_SEQ_CST);
+      if (!producers_list_.empty ())
+        {
+          producers_list_.resume_one ();
+        }
+
+      return result::ok;
+    }
+
+    /**
+     * @details
+     * If the queue is empty, the thread is linked to the consumers
+     * waiting list and suspended, until a producer adds an element.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    mpmc_queue_base::pop (void* elem)
+    {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      if (try_pop (elem) == result::ok)
+        {
+          return result::ok;
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_thread_node node
+        { crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              if (try_pop (elem) == result::ok)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the consumers waiting list.
+              scheduler::internal_link_node (consumers_list_, node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the waiting list,
+          // if not already removed by a producer.
+          scheduler::internal_unlink_node (node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+    /**
+     * @details
+     * If the queue is empty, the thread is linked to the consumers
+     * waiting list and suspended, until a producer adds an element,
+     * or the timeout, measured with the system clock, expires.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    mpmc_queue_base::timed_pop (void* elem, clock::duration_t timeout)
+    {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+      trace::printf ("%s(%u) @%p %s\n", __func__,
+                     static_cast<unsigned int> (timeout), this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      if (try_pop (elem) == result::ok)
+        {
+          return result::ok;
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_thread_node node
+        { crt_thread };
+
+      internal::clock_timestamps_list& clock_list = sysclock.steady_list ();
+      clock::timestamp_t timeout_timestamp = sysclock.steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              if (try_pop (elem) == result::ok)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the consumers waiting list,
+              // and the clock timeout list.
+              scheduler::internal_link_node (consumers_list_, node, clock_list,
+                                             timeout_node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the waiting list,
+          // if not already removed by a producer and from the clock
+          // timeout list, if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+              trace::printf ("%s(%u) EINTR @%p %s\n", __func__,
+                             static_cast<unsigned int> (timeout), this,
+                             name ());
+#endif
+              return EINTR;
+            }
+
+          if (sysclock.steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_MPMCQUEUE)
+              trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__,
+                             static_cast<unsigned int> (timeout), this,
+                             name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+  // --------------------------------------------------------------------------
+
+  } /* namespace rtos */
+} /* namespace os */
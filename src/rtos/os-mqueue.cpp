@@ -480,6 +480,7 @@ namespace os
 
       assert(send_list_.empty ());
       assert(receive_list_.empty ());
+      assert(sets_list_.empty ());
 
 #endif
 
@@ -584,17 +585,26 @@ namespace os
       prio_array_ =
           reinterpret_cast<priority_t*> (reinterpret_cast<char*> (const_cast<index_t*> (next_array_))
               + msgs * sizeof(index_t));
+      // The array of slot states follows immediately the priorities.
+      state_array_ =
+          reinterpret_cast<slot_state_t*> (reinterpret_cast<char*> (const_cast<priority_t*> (prio_array_))
+              + msgs * sizeof(priority_t));
 
 #if !defined(NDEBUG)
       char* p =
-          reinterpret_cast<char*> (reinterpret_cast<char*> (const_cast<priority_t*> (prio_array_))
-              + msgs * sizeof(priority_t));
+          reinterpret_cast<char*> (reinterpret_cast<char*> (const_cast<slot_state_t*> (state_array_))
+              + msgs * sizeof(slot_state_t));
 
       assert(
           p - static_cast<char*> (queue_addr_)
               <= static_cast<ptrdiff_t> (queue_size_bytes_));
 #endif
 
+      for (std::size_t i = 0; i < msgs_; ++i)
+        {
+          state_array_[i] = slot_state::free;
+        }
+
       internal_init_ ();
 #endif
     }
@@ -610,31 +620,49 @@ namespace os
       // the beginning of each block. Each block
       // will hold the address of the next free block,
       // or `nullptr` at the end.
-      char* p = static_cast<char*> (queue_addr_);
-      for (std::size_t i = 1; i < msgs_; ++i)
+      // The loaned and acquired slots are left to their owners,
+      // which may still be filling or reading them with interrupts
+      // enabled, and return them with `commit()` or `release()`.
+      first_free_ = nullptr;
+      for (std::size_t i = msgs_; i > 0; --i)
         {
-          // Compute the address of the next block;
-          char* pn = p + msg_size_bytes_;
+          std::size_t ix = i - 1;
+          if (state_array_[ix] == slot_state::loaned
+              || state_array_[ix] == slot_state::acquired)
+            {
+              continue;
+            }
 
-          // Make this block point to the next one.
-          *(static_cast<void**> (static_cast<void*> (p))) = pn;
-          // Advance pointer
-          p = pn;
-        }
+          char* p = static_cast<char*> (queue_addr_) + ix * msg_size_bytes_;
 
-      // Mark end of list.
-      *(static_cast<void**> (static_cast<void*> (p))) = nullptr;
+          // Make this block point to the next one.
+          *(static_cast<void**> (static_cast<void*> (p))) = first_free_;
+          first_free_ = p;
 
-      first_free_ = queue_addr_; // Pointer to first block.
+          state_array_[ix] = slot_state::free;
+        }
 
       head_ = no_index;
 
+#if defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP)
+      for (std::size_t i = 0; i < (max_priority + 1); ++i)
+        {
+          tails_[i] = no_index;
+        }
+      for (std::size_t i = 0; i < (max_priority + 1) / 32; ++i)
+        {
+          prio_map_[i] = 0;
+        }
+      prio_summary_ = 0;
+#endif /* defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP) */
+
       // Need not be inside the critical section,
       // the lists are protected by inner `resume_one()`.
 
       // Wake-up all threads, if any.
       send_list_.resume_all ();
       receive_list_.resume_all ();
+      sets_list_.resume_all ();
 
 #endif /* !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE) */
 
@@ -650,10 +678,10 @@ namespace os
     message_queue::internal_try_send_ (const void* msg, std::size_t nbytes,
                                        priority_t mprio)
     {
-      if (first_free_ == nullptr)
+      if (internal_try_handoff_ (msg, nbytes, mprio))
         {
-          // No available space to send the message.
-          return false;
+          // Delivered directly to a waiting receiver.
+          return true;
         }
 
       // The first step is to remove the free block from the list,
@@ -661,15 +689,19 @@ namespace os
 
       // Get the address where the message will be copied.
       // This is the first free memory block.
-      char* dest = static_cast<char*> (first_free_);
-
-      // Update to next free, if any (the last one has nullptr).
-      first_free_ = *(static_cast<void**> (first_free_));
+      char* dest = internal_try_loan_ ();
+      if (dest == nullptr)
+        {
+          // No available space to send the message.
+          return false;
+        }
 
-      // The second step is to copy the message from the user buffer.
+      // The second step is to copy the message from the user buffer,
+      // with interrupts enabled; the block is not in any list, so it
+      // is not visible to other calls, and `reset()` leaves it loaned.
         {
           // ----- Enter uncritical section -----------------------------------
-          // interrupts::uncritical_section iucs;
+          interrupts::uncritical_section iucs;
 
           // Copy message from user buffer to queue storage.
           std::memcpy (dest, msg, nbytes);
@@ -682,11 +714,123 @@ namespace os
         }
 
       // The third step is to link the buffer to the list.
+      internal_commit_ (dest, mprio);
+
+      return true;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     *
+     * If the queue is empty and the first thread waiting to receive
+     * has a buffer, copy the message straight into it and resume the
+     * thread, without going through the queue storage. Otherwise
+     * (for example when the first waiting thread is in `acquire()`),
+     * the message follows the normal path, to keep the order in
+     * which waiting threads are served.
+     *
+     * The copy is done with interrupts disabled, so messages larger
+     * than `OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES`
+     * always go through the queue storage.
+     */
+    bool
+    message_queue::internal_try_handoff_ (const void* msg, std::size_t nbytes,
+                                          priority_t mprio)
+    {
+      if (msg_size_bytes_ > OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES
+          || head_ != no_index || receive_list_.empty ())
+        {
+          return false;
+        }
+
+      internal::waiting_request_node* request_node =
+          static_cast<internal::waiting_request_node*> (const_cast<internal::waiting_thread_node*> (receive_list_.head ()));
+      if (request_node->request_ == 0)
+        {
+          // No buffer to copy to.
+          return false;
+        }
+
+      internal::waiting_message_node* node =
+          static_cast<internal::waiting_message_node*> (request_node);
+
+      // Same content as copying through the queue storage, which is
+      // padded with 0x00 up to the message size.
+      char* dest = static_cast<char*> (node->msg_);
+      std::size_t dest_nbytes = node->request_;
+      if (nbytes < dest_nbytes)
+        {
+          std::memcpy (dest, msg, nbytes);
+          std::memset (dest + nbytes, 0x00, dest_nbytes - nbytes);
+        }
+      else
+        {
+          std::memcpy (dest, msg, dest_nbytes);
+        }
+      node->prio_ = mprio;
+      node->satisfied_ = true;
+
+      thread* th = node->thread_;
+      node->unlink ();
+      th->resume ();
+
+      return true;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    char*
+    message_queue::internal_try_loan_ (void)
+    {
+      if (first_free_ == nullptr)
+        {
+          return nullptr;
+        }
+
+      char* msg = static_cast<char*> (first_free_);
+
+      // Update to next free, if any (the last one has nullptr).
+      first_free_ = *(static_cast<void**> (first_free_));
+
+      state_array_[internal_slot_index_ (msg)] = slot_state::loaned;
+
+      return msg;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    void
+    message_queue::internal_commit_ (char* msg, priority_t mprio)
+    {
+      internal_enqueue_ (msg, mprio);
+
+      // Wake-up one thread, if any, and the wait sets, which
+      // do not take the message.
+      receive_list_.resume_one ();
+      sets_list_.resume_all ();
+    }
 
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    void
+    message_queue::internal_enqueue_ (char* msg, priority_t mprio)
+    {
       // Using the address, compute the index in the array.
-      std::size_t msg_ix = (static_cast<std::size_t> (dest
-          - static_cast<char*> (queue_addr_)) / msg_size_bytes_);
+      std::size_t msg_ix = internal_slot_index_ (msg);
+
+      // Only a loaned slot may be linked; `reset()` does not free
+      // it, so a slot filled with interrupts enabled is still owned.
+      assert(state_array_[msg_ix] == slot_state::loaned);
+
       prio_array_[msg_ix] = mprio;
+      state_array_[msg_ix] = slot_state::queued;
 
       if (head_ == no_index)
         {
@@ -699,6 +843,34 @@ namespace os
       else
         {
           std::size_t ix;
+#if defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP)
+          // Find the lowest non-empty priority not below the new one;
+          // the new message goes right after its last message.
+          std::size_t word = mprio / 32;
+          uint32_t bits = prio_map_[word] & (~0u << (mprio % 32));
+          if (bits == 0)
+            {
+              // Words above the current one.
+              uint32_t words = prio_summary_ & ~((2u << word) - 1);
+              if (words != 0)
+                {
+                  word = static_cast<std::size_t> (__builtin_ctz (words));
+                  bits = prio_map_[word];
+                }
+            }
+          if (bits != 0)
+            {
+              ix = tails_[word * 32
+                  + static_cast<std::size_t> (__builtin_ctz (bits))];
+            }
+          else
+            {
+              // No message with the same or higher priority, the new
+              // message is inserted after the tail and becomes the head.
+              ix = prev_array_[head_];
+              head_ = static_cast<index_t> (msg_ix);
+            }
+#else
           // Arrange to insert between head and tail.
           ix = prev_array_[head_];
           // Check if the priority is higher than the head priority.
@@ -717,6 +889,7 @@ namespace os
                   ix = prev_array_[ix];
                 }
             }
+#endif /* defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP) */
           prev_array_[msg_ix] = static_cast<index_t> (ix);
           next_array_[msg_ix] = next_array_[ix];
 
@@ -726,13 +899,76 @@ namespace os
           prev_array_[tmp_ix] = static_cast<index_t> (msg_ix);
         }
 
+#if defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP)
+      // The new message is the last one with its priority.
+      tails_[mprio] = static_cast<index_t> (msg_ix);
+      prio_map_[mprio / 32] |= (1u << (mprio % 32));
+      prio_summary_ |= (1u << (mprio / 32));
+#endif /* defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP) */
+
       // One more message added to the queue.
       ++count_;
+    }
 
-      // Wake-up one thread, if any.
-      receive_list_.resume_one ();
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     *
+     * Messages are copied and linked one by one, as for `send()`,
+     * each copy with interrupts enabled, but the waiting receivers
+     * are resumed only once at the end, one for each enqueued message.
+     */
+    std::size_t
+    message_queue::internal_try_send_many_ (const char* msgs,
+                                            std::size_t nmsgs,
+                                            priority_t mprio)
+    {
+      std::size_t sent = 0;
+      std::size_t enqueued = 0;
 
-      return true;
+      for (; sent < nmsgs; ++sent)
+        {
+          const char* msg = msgs + sent * msg_size_bytes_;
+
+          if (internal_try_handoff_ (msg, msg_size_bytes_, mprio))
+            {
+              // Delivered directly to a waiting receiver.
+              continue;
+            }
+
+          char* dest = internal_try_loan_ ();
+          if (dest == nullptr)
+            {
+              // The queue is full.
+              break;
+            }
+
+          // Copy to the queue storage
+            {
+              // ----- Enter uncritical section -------------------------------
+              interrupts::uncritical_section iucs;
+
+              // Copy message from user buffer to queue storage.
+              std::memcpy (dest, msg, msg_size_bytes_);
+              // ----- Exit uncritical section --------------------------------
+            }
+
+          internal_enqueue_ (dest, mprio);
+          ++enqueued;
+        }
+
+      // Wake-up one thread for each message, if any.
+      if (enqueued > 0)
+        {
+          // The wait sets do not take the messages.
+          sets_list_.resume_all ();
+        }
+      while (enqueued > 0 && receive_list_.resume_one ())
+        {
+          --enqueued;
+        }
+
+      return sent;
     }
 
 #endif /* !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE) */
@@ -747,23 +983,72 @@ namespace os
     message_queue::internal_try_receive_ (void* msg, std::size_t nbytes,
                                           priority_t* mprio)
     {
+      priority_t prio;
 
-      if (head_ == no_index)
+      // Unlink it from the list, so another concurrent call will
+      // not get it too.
+      char* src = internal_try_acquire_ (&prio);
+      if (src == nullptr)
         {
           return false;
         }
 
-      // Compute the message source address.
-      char* src = static_cast<char*> (queue_addr_) + head_ * msg_size_bytes_;
-      priority_t prio = prio_array_[head_];
-
 #if defined(OS_TRACE_RTOS_MQUEUE_)
       trace::printf ("%s(%p,%u) @%p %s src %p %p\n", __func__, msg, nbytes,
           this, name (), src, first_free_);
 #endif
 
-      // Unlink it from the list, so another concurrent call will
-      // not get it too.
+      // Copy to destination
+        {
+          // ----- Enter uncritical section -----------------------------------
+          interrupts::uncritical_section iucs;
+
+          // Copy message from queue to user buffer.
+          memcpy (msg, src, nbytes);
+          if (mprio != nullptr)
+            {
+              *mprio = prio;
+            }
+          // ----- Exit uncritical section ------------------------------------
+        }
+
+      // After the message was copied, the block can be released.
+      internal_release_ (src);
+
+      return true;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    char*
+    message_queue::internal_try_acquire_ (priority_t* mprio)
+    {
+      if (head_ == no_index)
+        {
+          return nullptr;
+        }
+
+      // Compute the message address.
+      char* msg = static_cast<char*> (queue_addr_) + head_ * msg_size_bytes_;
+      *mprio = prio_array_[head_];
+      state_array_[head_] = slot_state::acquired;
+
+#if defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP)
+      if (tails_[*mprio] == head_)
+        {
+          // It was the last message with this priority.
+          tails_[*mprio] = no_index;
+          std::size_t word = *mprio / 32;
+          prio_map_[word] &= ~(1u << (*mprio % 32));
+          if (prio_map_[word] == 0)
+            {
+              prio_summary_ &= ~(1u << word);
+            }
+        }
+#endif /* defined(OS_USE_RTOS_MESSAGE_QUEUE_PRIORITY_BITMAP) */
+
       if (count_ > 1)
         {
           // Remove the current element from the list.
@@ -781,36 +1066,148 @@ namespace os
 
       --count_;
 
-      // Copy to destination
-        {
-          // ----- Enter uncritical section -----------------------------------
-          interrupts::uncritical_section iucs;
+      return msg;
+    }
 
-          // Copy message from queue to user buffer.
-          memcpy (msg, src, nbytes);
-          if (mprio != nullptr)
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    void
+    message_queue::internal_release_ (char* msg)
+    {
+      assert(
+          state_array_[internal_slot_index_ (msg)] == slot_state::loaned
+              || state_array_[internal_slot_index_ (msg)]
+                  == slot_state::acquired);
+
+      if (msg_size_bytes_ <= OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES
+          && !send_list_.empty ())
+        {
+          internal::waiting_request_node* request_node =
+              static_cast<internal::waiting_request_node*> (const_cast<internal::waiting_thread_node*> (send_list_.head ()));
+          if (request_node->request_ != 0)
             {
-              *mprio = prio;
+              // The first thread waiting to send has a message;
+              // instead of freeing the block and resuming the thread
+              // to retry, enqueue its message in the block right now.
+              internal::waiting_message_node* node =
+                  static_cast<internal::waiting_message_node*> (request_node);
+
+              std::size_t nbytes = node->request_;
+              std::memcpy (msg, node->msg_, nbytes);
+              if (nbytes < msg_size_bytes_)
+                {
+                  // Fill in the remaining space with 0x00.
+                  std::memset (msg + nbytes, 0x00, msg_size_bytes_ - nbytes);
+                }
+              node->satisfied_ = true;
+
+              thread* th = node->thread_;
+              node->unlink ();
+
+              // The block goes from the receiver to the sender.
+              state_array_[internal_slot_index_ (msg)] = slot_state::loaned;
+              internal_commit_ (msg, node->prio_);
+
+              th->resume ();
+              return;
             }
-          // ----- Exit uncritical section ------------------------------------
         }
 
-      // After the message was copied, the block can be released.
-
       // Perform a push_front() on the single linked LIFO list,
       // i.e. add the block to the beginning of the list.
 
       // Link previous list to this block; may be null, but it does
       // not matter.
-      *(static_cast<void**> (static_cast<void*> (src))) = first_free_;
+      *(static_cast<void**> (static_cast<void*> (msg))) = first_free_;
 
       // Now this block is the first one.
-      first_free_ = src;
+      first_free_ = msg;
+
+      state_array_[internal_slot_index_ (msg)] = slot_state::free;
 
       // Wake-up one thread, if any.
       send_list_.resume_one ();
+    }
 
-      return true;
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     *
+     * Messages are unlinked and copied one by one, as for `receive()`,
+     * but the blocks are released only once at the end, which also
+     * resumes the waiting senders.
+     */
+    std::size_t
+    message_queue::internal_try_receive_many_ (char* msgs,
+                                               std::size_t max_msgs,
+                                               priority_t* mprios)
+    {
+      std::size_t received = 0;
+
+      // The blocks already copied, in a local single linked list.
+      char* done = nullptr;
+
+      while (received < max_msgs)
+        {
+          priority_t prio;
+          char* src = internal_try_acquire_ (&prio);
+          if (src == nullptr)
+            {
+              break;
+            }
+
+          // Copy to destination
+            {
+              // ----- Enter uncritical section -------------------------------
+              interrupts::uncritical_section iucs;
+
+              // Copy message from queue to user buffer.
+              std::memcpy (msgs + received * msg_size_bytes_, src,
+                           msg_size_bytes_);
+              if (mprios != nullptr)
+                {
+                  mprios[received] = prio;
+                }
+              // ----- Exit uncritical section --------------------------------
+            }
+
+          *(static_cast<void**> (static_cast<void*> (src))) = done;
+          done = src;
+
+          ++received;
+        }
+
+      while (done != nullptr)
+        {
+          char* next = static_cast<char*> (*(static_cast<void**> (static_cast<void*> (done))));
+          internal_release_ (done);
+          done = next;
+        }
+
+      return received;
+    }
+
+    bool
+    message_queue::internal_is_slot_ (const void* msg) const
+    {
+      const char* p = static_cast<const char*> (msg);
+      const char* base = static_cast<const char*> (queue_addr_);
+
+      if (p < base || p >= base + msgs_ * msg_size_bytes_)
+        {
+          return false;
+        }
+
+      return (static_cast<std::size_t> (p - base) % msg_size_bytes_) == 0;
+    }
+
+    std::size_t
+    message_queue::internal_slot_index_ (const void* msg) const
+    {
+      return static_cast<std::size_t> (static_cast<const char*> (msg)
+          - static_cast<const char*> (queue_addr_)) / msg_size_bytes_;
     }
 
 #endif /* !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE) */
@@ -835,7 +1232,7 @@ namespace os
      * larger numeric value of _mprio_ shall be inserted before messages
      * with lower values of _mprio_. A message shall be inserted after
      * other messages in the queue, if any, with equal _mprio_. The
-     * value of _mprio_ shall be less than `message_queue::max_priority`.
+     * value of _mprio_ shall not be greater than `message_queue::max_priority`.
      *
      * If the specified message queue is full, `send()`
      * shall block
@@ -849,6 +1246,17 @@ namespace os
      * message. Otherwise, it is unspecified which waiting thread
      * is unblocked.
      *
+     * If the queue is empty and a thread is waiting to receive,
+     * the message is copied directly to the receiver buffer,
+     * bypassing the queue storage. Conversely, a thread blocked
+     * in `send()` gets its message enqueued by the receiver which
+     * frees a slot, without having to retry. These copies are done
+     * with interrupts disabled, so they are performed only for
+     * messages up to `OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES`;
+     * otherwise, the payload is copied with interrupts enabled,
+     * only the slot allocation and linking being done in
+     * critical sections.
+     *
      * @par POSIX compatibility
      *  Inspired by [`mq_send()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/mq_send.html)
      *  with `O_NONBLOCK` not set,
@@ -892,8 +1300,8 @@ namespace os
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_message_node node
+        { crt_thread, const_cast<void*> (msg), nbytes, mprio };
 
       for (;;)
         {
@@ -918,6 +1326,13 @@ namespace os
           // if not already removed by receive().
           scheduler::internal_unlink_node (node);
 
+          if (node.satisfied_)
+            {
+              // The message was enqueued by the receiver which
+              // freed a block.
+              return result::ok;
+            }
+
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_MQUEUE)
@@ -950,7 +1365,7 @@ namespace os
      * larger numeric value of _mprio_ shall be inserted before messages
      * with lower values of _mprio_. A message shall be inserted after
      * other messages in the queue, if any, with equal _mprio_. The
-     * value of _mprio_ shall be less than `message_queue::max_priority`.
+     * value of _mprio_ shall not be greater than `message_queue::max_priority`.
      *
      * If the message queue is full, the message shall
      * not be queued and `try_send()` shall return an error.
@@ -1017,7 +1432,7 @@ namespace os
      * larger numeric value of _mprio_ shall be inserted before messages
      * with lower values of _mprio_. A message shall be inserted after
      * other messages in the queue, if any, with equal _mprio_. The
-     * value of _mprio_ shall be less than `message_queue::max_priority`.
+     * value of _mprio_ shall not be greater than `message_queue::max_priority`.
      *
      * If the message queue is full, the wait for sufficient
      * room in the queue shall be terminated when the specified timeout
@@ -1086,8 +1501,8 @@ namespace os
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_message_node node
+        { crt_thread, const_cast<void*> (msg), nbytes, mprio };
 
       internal::clock_timestamps_list& clock_list = clock_->steady_list ();
 
@@ -1123,6 +1538,13 @@ namespace os
           // if not already removed by the timer.
           scheduler::internal_unlink_node (node, timeout_node);
 
+          if (node.satisfied_)
+            {
+              // The message was enqueued by the receiver which
+              // freed a block.
+              return result::ok;
+            }
+
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_MQUEUE)
@@ -1220,8 +1642,8 @@ namespace os
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_message_node node
+        { crt_thread, msg, nbytes, 0 };
 
       for (;;)
         {
@@ -1246,6 +1668,16 @@ namespace os
           // if not already removed by send().
           scheduler::internal_unlink_node (node);
 
+          if (node.satisfied_)
+            {
+              // The message was copied directly by a sender.
+              if (mprio != nullptr)
+                {
+                  *mprio = node.prio_;
+                }
+              return result::ok;
+            }
+
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_MQUEUE)
@@ -1430,8 +1862,8 @@ namespace os
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_message_node node
+        { crt_thread, msg, nbytes, 0 };
 
       internal::clock_timestamps_list& clock_list = clock_->steady_list ();
       clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
@@ -1466,10 +1898,20 @@ namespace os
           // timeout list, if not already removed by the timer.
           scheduler::internal_unlink_node (node, timeout_node);
 
-          if (crt_thread.interrupted ())
+          if (node.satisfied_)
             {
-#if defined(OS_TRACE_RTOS_MQUEUE)
-              trace::printf ("%s(%p,%u,%u) EINTR @%p %s\n", __func__, msg,
+              // The message was copied directly by a sender.
+              if (mprio != nullptr)
+                {
+                  *mprio = node.prio_;
+                }
+              return result::ok;
+            }
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u,%u) EINTR @%p %s\n", __func__, msg,
                              nbytes, timeout, this, name ());
 #endif
               return EINTR;
@@ -1493,8 +1935,1303 @@ namespace os
 
     /**
      * @details
-     * Clear both send and receive counter and return the queue to the
-     * initial state.
+     * The `send_many()` function shall add to the message queue
+     * the _nmsgs_ messages stored contiguously in the array
+     * pointed to by _msgs_, each of `msg_size()` bytes, all with
+     * the priority _mprio_, in the order of the array.
+     *
+     * As many messages as fit are copied in a single critical
+     * section, and the threads waiting to receive are resumed
+     * only once, at the end.
+     *
+     * If the queue becomes full, `send_many()` shall block until
+     * space becomes available for the remaining messages, or until
+     * `send_many()` is cancelled/interrupted, with the same
+     * semantics as `send()`.
+     *
+     * If _sent_ is not nullptr, the number of messages enqueued
+     * shall be stored in the location referenced by _sent_, also
+     * when the function fails.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::send_many (const void* msgs, std::size_t nmsgs,
+                              std::size_t* sent, priority_t mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u,%u) @%p %s\n", __func__, msgs, nmsgs, mprio,
+                     this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msgs != nullptr, EINVAL);
+      os_assert_err(nmsgs > 0, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      const char* p = static_cast<const char*> (msgs);
+
+      std::size_t count;
+      std::size_t& done = (sent != nullptr) ? *sent : count;
+      done = 0;
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          done = internal_try_send_many_ (p, nmsgs, mprio);
+          if (done == nmsgs)
+            {
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, const_cast<char*> (p), msg_size_bytes_, mprio };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              done += internal_try_send_many_ (p + done * msg_size_bytes_,
+                                               nmsgs - done, mprio);
+              if (done == nmsgs)
+                {
+                  return result::ok;
+                }
+
+              // The receiver which frees a block may enqueue
+              // the next message on behalf of this thread.
+              node.msg_ = const_cast<char*> (p + done * msg_size_bytes_);
+              node.satisfied_ = false;
+
+              // Add this thread to the message queue send waiting list.
+              scheduler::internal_link_node (send_list_, node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue send waiting list,
+          // if not already removed by receive().
+          scheduler::internal_unlink_node (node);
+
+          if (node.satisfied_)
+            {
+              // One message was enqueued by the receiver which
+              // freed a block.
+              if (++done == nmsgs)
+                {
+                  return result::ok;
+                }
+            }
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u,%u) EINTR @%p %s\n", __func__, msgs,
+                             nmsgs, mprio, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `try_send_many()` function shall try to add to the
+     * message queue the messages stored in the array pointed to
+     * by _msgs_, as described for `send_many()`, but only as many
+     * as fit in the queue, without blocking.
+     *
+     * If the message queue is full, no message shall be
+     * queued and `try_send_many()` shall return an error.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::try_send_many (const void* msgs, std::size_t nmsgs,
+                                  std::size_t* sent, priority_t mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u,%u) @%p %s\n", __func__, msgs, nmsgs, mprio,
+                     this, name ());
+#endif
+
+      os_assert_err(msgs != nullptr, EINVAL);
+      os_assert_err(nmsgs > 0, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      assert(port::interrupts::is_priority_valid ());
+
+      std::size_t done;
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          done = internal_try_send_many_ (static_cast<const char*> (msgs),
+                                          nmsgs, mprio);
+          // ----- Exit critical section --------------------------------------
+        }
+
+      if (sent != nullptr)
+        {
+          *sent = done;
+        }
+      if (done == 0)
+        {
+          return EWOULDBLOCK;
+        }
+      return result::ok;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `timed_send_many()` function shall add to the message
+     * queue the messages stored in the array pointed to by _msgs_,
+     * as described for `send_many()`. However, if the queue is full,
+     * the wait for sufficient room shall be terminated when the
+     * specified timeout expires, with the same semantics as
+     * `timed_send()`. The timeout applies to the whole array.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::timed_send_many (const void* msgs, std::size_t nmsgs,
+                                    std::size_t* sent,
+                                    clock::duration_t timeout,
+                                    priority_t mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u,%u,%u) @%p %s\n", __func__, msgs, nmsgs, mprio,
+                     timeout, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msgs != nullptr, EINVAL);
+      os_assert_err(nmsgs > 0, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      const char* p = static_cast<const char*> (msgs);
+
+      std::size_t count;
+      std::size_t& done = (sent != nullptr) ? *sent : count;
+      done = 0;
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          done = internal_try_send_many_ (p, nmsgs, mprio);
+          if (done == nmsgs)
+            {
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, const_cast<char*> (p), msg_size_bytes_, mprio };
+
+      internal::clock_timestamps_list& clock_list = clock_->steady_list ();
+      clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              done += internal_try_send_many_ (p + done * msg_size_bytes_,
+                                               nmsgs - done, mprio);
+              if (done == nmsgs)
+                {
+                  return result::ok;
+                }
+
+              // The receiver which frees a block may enqueue
+              // the next message on behalf of this thread.
+              node.msg_ = const_cast<char*> (p + done * msg_size_bytes_);
+              node.satisfied_ = false;
+
+              // Add this thread to the message queue send waiting list,
+              // and the clock timeout list.
+              scheduler::internal_link_node (send_list_, node, clock_list,
+                                             timeout_node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue send waiting list,
+          // if not already removed by receive() and from the clock timeout list,
+          // if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+
+          if (node.satisfied_)
+            {
+              // One message was enqueued by the receiver which
+              // freed a block.
+              if (++done == nmsgs)
+                {
+                  return result::ok;
+                }
+            }
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u,%u,%u) EINTR @%p %s\n", __func__, msgs,
+                             nmsgs, mprio, timeout, this, name ());
+#endif
+              return EINTR;
+            }
+
+          if (clock_->steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u,%u,%u) ETIMEDOUT @%p %s\n", __func__,
+                             msgs, nmsgs, mprio, timeout, this, name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `receive_many()` function shall remove from the message
+     * queue up to _max_msgs_ messages, in the same order as
+     * successive `receive()` calls, and copy them contiguously in the
+     * array pointed to by _msgs_, each of `msg_size()` bytes.
+     * The number of messages received shall be stored in the location
+     * referenced by _received_.
+     *
+     * If the argument _mprios_ is not nullptr, it must point to
+     * an array of _max_msgs_ elements, where the priorities of the
+     * received messages shall be stored.
+     *
+     * All available messages, up to _max_msgs_, are moved in a
+     * single call, and the threads waiting to send are resumed
+     * only once, at the end.
+     *
+     * If the message queue is empty, `receive_many()` shall block
+     * until at least one message is enqueued, or until `receive_many()`
+     * is cancelled/interrupted, with the same semantics as `receive()`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::receive_many (void* msgs, std::size_t max_msgs,
+                                 std::size_t* received, priority_t* mprios)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u) @%p %s\n", __func__, msgs, max_msgs, this,
+                     name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msgs != nullptr, EINVAL);
+      os_assert_err(max_msgs > 0, EINVAL);
+      os_assert_err(received != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      char* p = static_cast<char*> (msgs);
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *received = internal_try_receive_many_ (p, max_msgs, mprios);
+          if (*received > 0)
+            {
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, p, msg_size_bytes_, 0 };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              *received = internal_try_receive_many_ (p, max_msgs, mprios);
+              if (*received > 0)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the message queue receive waiting list.
+              scheduler::internal_link_node (receive_list_, node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue receive waiting list,
+          // if not already removed by send().
+          scheduler::internal_unlink_node (node);
+
+          if (node.satisfied_)
+            {
+              // The first message was copied directly by a sender.
+              *received = 1;
+              if (mprios != nullptr)
+                {
+                  mprios[0] = node.prio_;
+                }
+              return result::ok;
+            }
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u) EINTR @%p %s\n", __func__, msgs,
+                             max_msgs, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `try_receive_many()` function shall try to remove from
+     * the message queue up to _max_msgs_ messages, as described
+     * for `receive_many()`.
+     *
+     * If the message queue is empty, no message shall be removed
+     * from the queue, and `try_receive_many()` shall return an error.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::try_receive_many (void* msgs, std::size_t max_msgs,
+                                     std::size_t* received,
+                                     priority_t* mprios)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u) @%p %s\n", __func__, msgs, max_msgs, this,
+                     name ());
+#endif
+
+      os_assert_err(msgs != nullptr, EINVAL);
+      os_assert_err(max_msgs > 0, EINVAL);
+      os_assert_err(received != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      assert(port::interrupts::is_priority_valid ());
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *received = internal_try_receive_many_ (static_cast<char*> (msgs),
+                                                  max_msgs, mprios);
+          // ----- Exit critical section --------------------------------------
+        }
+
+      if (*received == 0)
+        {
+          return EWOULDBLOCK;
+        }
+      return result::ok;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `timed_receive_many()` function shall remove from the
+     * message queue up to _max_msgs_ messages, as described for
+     * `receive_many()`. However, if no message exists on the queue,
+     * the wait for a message shall be terminated when the specified
+     * timeout expires, with the same semantics as `timed_receive()`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::timed_receive_many (void* msgs, std::size_t max_msgs,
+                                       std::size_t* received,
+                                       clock::duration_t timeout,
+                                       priority_t* mprios)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u,%u) @%p %s\n", __func__, msgs, max_msgs,
+                     timeout, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msgs != nullptr, EINVAL);
+      os_assert_err(max_msgs > 0, EINVAL);
+      os_assert_err(received != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      char* p = static_cast<char*> (msgs);
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *received = internal_try_receive_many_ (p, max_msgs, mprios);
+          if (*received > 0)
+            {
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, p, msg_size_bytes_, 0 };
+
+      internal::clock_timestamps_list& clock_list = clock_->steady_list ();
+      clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              *received = internal_try_receive_many_ (p, max_msgs, mprios);
+              if (*received > 0)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the message queue receive waiting list,
+              // and the clock timeout list.
+              scheduler::internal_link_node (receive_list_, node, clock_list,
+                                             timeout_node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue receive waiting list,
+          // if not already removed by send() and from the clock
+          // timeout list, if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+
+          if (node.satisfied_)
+            {
+              // The first message was copied directly by a sender.
+              *received = 1;
+              if (mprios != nullptr)
+                {
+                  mprios[0] = node.prio_;
+                }
+              return result::ok;
+            }
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u,%u) EINTR @%p %s\n", __func__, msgs,
+                             max_msgs, timeout, this, name ());
+#endif
+              return EINTR;
+            }
+
+          if (clock_->steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%p,%u,%u) ETIMEDOUT @%p %s\n", __func__,
+                             msgs, max_msgs, timeout, this, name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `loan()` function shall remove a free message slot
+     * from the queue storage and store its address in the location
+     * referenced by _msg_. The caller may then build the message
+     * directly in the slot, up to `msg_size()` bytes, and
+     * enqueue it with `commit()`, avoiding the copy done by `send()`.
+     * A slot which is no longer needed can be returned
+     * with `release()`.
+     *
+     * While loaned, the slot counts against the queue capacity but
+     * not against its length. A `reset()` discards the queued
+     * messages, but not the loaned slots, which must still be
+     * committed or released.
+     *
+     * If there are no free slots, `loan()` shall block
+     * until a slot is freed, or until `loan()` is cancelled/interrupted,
+     * with the same semantics as `send()`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::loan (void** msg)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msg != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *msg = internal_try_loan_ ();
+          if (*msg != nullptr)
+            {
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, nullptr, 0, 0 };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              *msg = internal_try_loan_ ();
+              if (*msg != nullptr)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the message queue send waiting list.
+              scheduler::internal_link_node (send_list_, node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue send waiting list,
+          // if not already removed by receive().
+          scheduler::internal_unlink_node (node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `try_loan()` function shall try to remove a free message
+     * slot from the queue storage, as described for `loan()`.
+     *
+     * If there are no free slots, `try_loan()` shall
+     * return an error.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::try_loan (void** msg)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(msg != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      assert(port::interrupts::is_priority_valid ());
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *msg = internal_try_loan_ ();
+          if (*msg != nullptr)
+            {
+              return result::ok;
+            }
+          else
+            {
+              return EWOULDBLOCK;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `timed_loan()` function shall remove a free message
+     * slot from the queue storage, as described for `loan()`.
+     * However, if there are no free slots, the wait shall be
+     * terminated when the specified timeout expires,
+     * with the same semantics as `timed_send()`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::timed_loan (void** msg, clock::duration_t timeout)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%u) @%p %s\n", __func__, timeout, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msg != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *msg = internal_try_loan_ ();
+          if (*msg != nullptr)
+            {
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, nullptr, 0, 0 };
+
+      internal::clock_timestamps_list& clock_list = clock_->steady_list ();
+      clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              *msg = internal_try_loan_ ();
+              if (*msg != nullptr)
+                {
+                  return result::ok;
+                }
+
+              // Add this thread to the message queue send waiting list,
+              // and the clock timeout list.
+              scheduler::internal_link_node (send_list_, node, clock_list,
+                                             timeout_node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue send waiting list,
+          // if not already removed by receive() and from the clock timeout list,
+          // if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%u) EINTR @%p %s\n", __func__, timeout, this,
+                             name ());
+#endif
+              return EINTR;
+            }
+
+          if (clock_->steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__, timeout,
+                             this, name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `commit()` function shall enqueue the message built in
+     * the slot obtained with `loan()`, at the position indicated
+     * by the _mprio_ argument, with the same ordering as `send()`,
+     * and wake up a thread waiting to receive, if any.
+     *
+     * Only a slot obtained with `loan()` and not yet committed or
+     * released is accepted; any other slot is rejected with `EINVAL`.
+     * As for `send()`, all values of _mprio_ are valid.
+     *
+     * The whole slot is delivered; unlike `send()`, the unused
+     * space is not cleared. After `commit()` the slot belongs
+     * to the queue and must no longer be accessed.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::commit (void* msg, priority_t mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p,%u) @%p %s\n", __func__, msg, mprio, this,
+                     name ());
+#endif
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      os_assert_err(internal_is_slot_ (msg), EINVAL);
+
+      assert(port::interrupts::is_priority_valid ());
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Only a loaned slot can be committed; committing it twice,
+          // or a slot never loaned, would corrupt the lists.
+          os_assert_err(
+              state_array_[internal_slot_index_ (msg)] == slot_state::loaned,
+              EINVAL);
+
+          internal_commit_ (static_cast<char*> (msg), mprio);
+          // ----- Exit critical section --------------------------------------
+        }
+
+      return result::ok;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `acquire()` function shall remove the oldest of the
+     * highest priority message(s) from the message queue, as
+     * described for `receive()`, but instead of copying it, shall
+     * store the address of its slot in the location referenced
+     * by _msg_. The caller may then use the message in place,
+     * and must return the slot to the queue with `release()`,
+     * even if the queue was reset meanwhile.
+     *
+     * If the argument _mprio_ is not nullptr, the priority of the selected
+     * message shall be stored in the location referenced by _mprio_.
+     *
+     * If the message queue is empty, `acquire()` shall block
+     * until a message is enqueued on the message queue or until
+     * `acquire()` is cancelled/interrupted, with the same semantics
+     * as `receive()`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::acquire (void** msg, priority_t* mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msg != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      priority_t prio;
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *msg = internal_try_acquire_ (&prio);
+          if (*msg != nullptr)
+            {
+              if (mprio != nullptr)
+                {
+                  *mprio = prio;
+                }
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, nullptr, 0, 0 };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              *msg = internal_try_acquire_ (&prio);
+              if (*msg != nullptr)
+                {
+                  if (mprio != nullptr)
+                    {
+                      *mprio = prio;
+                    }
+                  return result::ok;
+                }
+
+              // Add this thread to the message queue receive waiting list.
+              scheduler::internal_link_node (receive_list_, node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue receive waiting list,
+          // if not already removed by send().
+          scheduler::internal_unlink_node (node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `try_acquire()` function shall try to remove the oldest
+     * of the highest priority message(s) from the message queue,
+     * as described for `acquire()`.
+     *
+     * If the message queue is empty, no message shall be removed
+     * from the queue, and `try_acquire()` shall return an error.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::try_acquire (void** msg, priority_t* mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(msg != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      assert(port::interrupts::is_priority_valid ());
+
+      priority_t prio;
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *msg = internal_try_acquire_ (&prio);
+          if (*msg == nullptr)
+            {
+              return EWOULDBLOCK;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      if (mprio != nullptr)
+        {
+          *mprio = prio;
+        }
+      return result::ok;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `timed_acquire()` function shall remove the oldest of
+     * the highest priority message(s) from the message queue, as
+     * described for `acquire()`. However, if no message exists on the
+     * queue, the wait for such a message shall be terminated when
+     * the specified timeout expires, with the same semantics as
+     * `timed_receive()`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::timed_acquire (void** msg, clock::duration_t timeout,
+                                  priority_t* mprio)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%u) @%p %s\n", __func__, timeout, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(msg != nullptr, EINVAL);
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      priority_t prio;
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          *msg = internal_try_acquire_ (&prio);
+          if (*msg != nullptr)
+            {
+              if (mprio != nullptr)
+                {
+                  *mprio = prio;
+                }
+              return result::ok;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_message_node node
+        { crt_thread, nullptr, 0, 0 };
+
+      internal::clock_timestamps_list& clock_list = clock_->steady_list ();
+      clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              *msg = internal_try_acquire_ (&prio);
+              if (*msg != nullptr)
+                {
+                  if (mprio != nullptr)
+                    {
+                      *mprio = prio;
+                    }
+                  return result::ok;
+                }
+
+              // Add this thread to the message queue receive waiting list,
+              // and the clock timeout list.
+              scheduler::internal_link_node (receive_list_, node, clock_list,
+                                             timeout_node);
+              // state::suspended set in above link().
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the message queue receive waiting list,
+          // if not already removed by send() and from the clock
+          // timeout list, if not already removed by the timer.
+          scheduler::internal_unlink_node (node, timeout_node);
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%u) EINTR @%p %s\n", __func__, timeout, this,
+                             name ());
+#endif
+              return EINTR;
+            }
+
+          if (clock_->steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+              trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__, timeout,
+                             this, name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+
+#endif
+    }
+
+    /**
+     * @details
+     * The `release()` function shall return to the queue storage
+     * the slot obtained with `acquire()`, after the message was
+     * consumed, or a slot obtained with `loan()` which will not
+     * be committed, and wake up a thread waiting to send, if any.
+     * After `release()` the slot must no longer be accessed.
+     *
+     * A slot which is free, or still in the queue, is rejected
+     * with `EINVAL`.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     */
+    result_t
+    message_queue::release (void* msg)
+    {
+#if defined(OS_TRACE_RTOS_MQUEUE)
+      trace::printf ("%s(%p) @%p %s\n", __func__, msg, this, name ());
+#endif
+
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+
+      return ENOTSUP;
+
+#else
+
+      os_assert_err(internal_is_slot_ (msg), EINVAL);
+
+      assert(port::interrupts::is_priority_valid ());
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          // Releasing a free slot, or one still in the queue, would
+          // corrupt the lists.
+          slot_state_t state = state_array_[internal_slot_index_ (msg)];
+          os_assert_err(
+              state == slot_state::loaned || state == slot_state::acquired,
+              EINVAL);
+
+          internal_release_ (static_cast<char*> (msg));
+          // ----- Exit critical section --------------------------------------
+        }
+
+      return result::ok;
+
+#endif
+    }
+
+    /**
+     * @details
+     * Clear both send and receive counter and return the queue to the
+     * initial state.
+     *
+     * The slots obtained with `loan()` or `acquire()` are not
+     * reclaimed; they remain valid and are returned with `commit()`
+     * or `release()`. This also covers the slots used by `send()`
+     * and `receive()`, which copy the message with interrupts
+     * enabled.
      *
      * @par POSIX compatibility
      *  Extension to standard, no POSIX similar functionality identified.
@@ -297,6 +297,17 @@ namespace os
     using mutexes_list = utils::intrusive_list<
     mutex, utils::double_list_links, &mutex::owner_links_>;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+    namespace
+    {
+      // All mutexes, linked by their constructors.
+      // No constructor code, safe for static mutexes in other units.
+      mutex::statistics_list statistics_mutexes_;
+    } /* namespace */
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
     // ------------------------------------------------------------------------
 
     /**
@@ -492,6 +503,16 @@ namespace os
       initial_prio_ceiling_ = attr.mx_priority_ceiling;
       prio_ceiling_ = attr.mx_priority_ceiling;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          statistics_mutexes_.link (*this);
+          // ----- Exit critical section --------------------------------------
+        }
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
 #if defined(OS_USE_RTOS_PORT_MUTEX)
 
       count_ = 0;
@@ -527,6 +548,16 @@ namespace os
       trace::printf ("%s() @%p %s\n", __func__, this, name ());
 #endif
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          statistics_links_.unlink ();
+          // ----- Exit critical section --------------------------------------
+        }
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
 #if defined(OS_USE_RTOS_PORT_MUTEX)
 
       port::mutex::destroy (this);
@@ -555,6 +586,10 @@ namespace os
       consistent_ = true;
       recoverable_ = true;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+      statistics_.lock_timestamp_ = 0;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
 #if !defined(OS_USE_RTOS_PORT_MUTEX)
 
       // Wake-up all threads, if any.
@@ -573,24 +608,42 @@ namespace os
     mutex::internal_try_lock_ (thread* crt_thread)
     {
       // Save the initial owner for later protocol tests.
-      thread* saved_owner = owner_;
+      thread* saved_owner = internal_owner_ ();
 
       // First lock.
       if (owner_ == nullptr)
         {
           // If the mutex has no owner, own it.
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX)
+          if (!list_.empty ())
+            {
+              // Other threads are still waiting, keep unlock()
+              // on the slow path.
+              owner_ = reinterpret_cast<thread*> (reinterpret_cast<uintptr_t> (crt_thread)
+                  | 1);
+            }
+          else
+            {
+              owner_ = crt_thread;
+            }
+#else
           owner_ = crt_thread;
+#endif
 
           // For recursive mutexes, initialise counter.
           count_ = 1;
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+          internal_stats_acquired_ ();
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
           // When the mutex is acquired, some more actions are
           // required, according to mutex attributes.
 
           if (robustness_ == robustness::robust)
             {
               mutexes_list* th_list =
-                  reinterpret_cast<mutexes_list*> (&owner_->mutexes_);
+                  reinterpret_cast<mutexes_list*> (&crt_thread->mutexes_);
               th_list->link (*this);
             }
           else
@@ -620,12 +673,12 @@ namespace os
 
               // Boost priority.
               boosted_prio_ = prio_ceiling_;
-              if (boosted_prio_ > owner_->priority_inherited ())
+              if (boosted_prio_ > crt_thread->priority_inherited ())
                 {
                   // ----- Enter uncritical section ---------------------------
                   scheduler::uncritical_section sucs;
 
-                  owner_->priority_inherited (boosted_prio_);
+                  crt_thread->priority_inherited (boosted_prio_);
                   // ----- Exit uncritical section ----------------------------
                 }
             }
@@ -692,6 +745,16 @@ namespace os
         {
           // Try to lock when not owner (another thread requested the mutex).
 
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX)
+          // The caller may wait; mark the mutex as contended,
+          // so that the owner unlocks it on the slow path, which
+          // resumes the waiting threads. The owner cannot run
+          // while the scheduler is locked, and a compare-and-swap
+          // interrupted by the context switch fails.
+          owner_ = reinterpret_cast<thread*> (reinterpret_cast<uintptr_t> (saved_owner)
+              | 1);
+#endif
+
           // POSIX: When a thread makes a call to mutex::lock(), the mutex was
           // initialised with the protocol attribute having the value
           // mutex::protocol::inherit, when the calling thread is blocked
@@ -711,19 +774,23 @@ namespace os
               boosted_prio_ = prio;
 
               mutexes_list* th_list =
-                  reinterpret_cast<mutexes_list*> (&owner_->mutexes_);
+                  reinterpret_cast<mutexes_list*> (&saved_owner->mutexes_);
               if (owner_links_.unlinked ())
                 {
                   th_list->link (*this);
                 }
 
               // Boost owner priority.
-              if ((boosted_prio_ > owner_->priority_inherited ()))
+              if ((boosted_prio_ > saved_owner->priority_inherited ()))
                 {
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+                  ++statistics_.boosts_;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
                   // ----- Enter uncritical section ---------------------------
                   scheduler::uncritical_section sucs;
 
-                  owner_->priority_inherited (boosted_prio_);
+                  saved_owner->priority_inherited (boosted_prio_);
                   // ----- Exit uncritical section ----------------------------
                 }
 
@@ -741,6 +808,224 @@ namespace os
       return EWOULDBLOCK;
     }
 
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX)
+
+    // Without critical sections, the owner word is the lock word:
+    // nullptr when unlocked, the owner thread when locked and no
+    // other thread waits, or the owner with bit 0 set when
+    // the mutex is contended and unlock() must take the slow path.
+    inline bool
+    mutex::internal_fast_lock_ (thread* crt_thread)
+    {
+      if (!internal_fast_path_ ())
+        {
+          return false;
+        }
+
+      thread* expected = nullptr;
+      if (!__atomic_compare_exchange_n (&owner_, &expected, crt_thread, false,
+      __ATOMIC_ACQUIRE,
+                                        __ATOMIC_RELAXED))
+        {
+          // Locked, possibly by this thread; the slow path
+          // decides between waiting and returning an error.
+          return false;
+        }
+
+      // Only the owner touches these.
+      count_ = 1;
+      ++(crt_thread->acquired_mutexes_);
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+      internal_stats_acquired_ ();
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
+      if (!list_.empty ())
+        {
+          // Threads resumed by a previous unlock() but not yet
+          // running may still be in the list; they must be
+          // resumed by the slow unlock. If it fails, a waiting
+          // thread already set the flag.
+          expected = crt_thread;
+          __atomic_compare_exchange_n (
+              &owner_, &expected,
+              reinterpret_cast<thread*> (reinterpret_cast<uintptr_t> (crt_thread)
+                  | 1),
+              false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+
+#if defined(OS_TRACE_RTOS_MUTEX)
+      trace::printf ("%s() @%p %s by %p %s LCK\n", __func__, this, name (),
+                     crt_thread, crt_thread->name ());
+#endif
+      return true;
+    }
+
+    inline bool
+    mutex::internal_fast_unlock_ (thread* crt_thread)
+    {
+      if (!internal_fast_path_ () || owner_ != crt_thread)
+        {
+          // Not owner, or contended.
+          return false;
+        }
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+      // While still the owner; if the compare-and-swap fails,
+      // the slow path does not account it again.
+      internal_stats_released_ ();
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
+      // From now on, other threads can only set the contended flag,
+      // which makes the compare-and-swap fail.
+      count_ = 0;
+
+      thread* expected = crt_thread;
+      if (!__atomic_compare_exchange_n (&owner_, &expected, nullptr, false,
+      __ATOMIC_RELEASE,
+                                        __ATOMIC_RELAXED))
+        {
+          return false;
+        }
+
+      --(crt_thread->acquired_mutexes_);
+
+#if defined(OS_TRACE_RTOS_MUTEX)
+      trace::printf ("%s() @%p %s ULCK\n", __func__, this, name ());
+#endif
+      return true;
+    }
+
+#endif /* defined(OS_USE_RTOS_MUTEX_FAST_PATH) && !defined(OS_USE_RTOS_PORT_MUTEX) */
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+    // Called by the new owner.
+    void
+    mutex::internal_stats_acquired_ (void)
+    {
+      ++statistics_.acquisitions_;
+      statistics_.lock_timestamp_ = hrclock.now ();
+    }
+
+    // Called by the new owner, after internal_stats_acquired_().
+    void
+    mutex::internal_stats_contended_ (clock::timestamp_t wait_begin)
+    {
+      rtos::statistics::duration_t delta =
+          static_cast<rtos::statistics::duration_t> (statistics_.lock_timestamp_
+              - wait_begin);
+
+      ++statistics_.contended_acquisitions_;
+      statistics_.wait_cycles_ += delta;
+      if (delta > statistics_.max_wait_cycles_)
+        {
+          statistics_.max_wait_cycles_ = delta;
+        }
+    }
+
+    // Called by the owner, before releasing the mutex.
+    void
+    mutex::internal_stats_released_ (void)
+    {
+      if (statistics_.lock_timestamp_ == 0)
+        {
+          // Already accounted.
+          return;
+        }
+
+      rtos::statistics::duration_t delta =
+          static_cast<rtos::statistics::duration_t> (hrclock.now ()
+              - statistics_.lock_timestamp_);
+      statistics_.lock_timestamp_ = 0;
+
+      statistics_.hold_cycles_ += delta;
+      if (delta > statistics_.max_hold_cycles_)
+        {
+          statistics_.max_hold_cycles_ = delta;
+        }
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
+#if !defined(OS_USE_RTOS_PORT_MUTEX)
+
+    /*
+     * Internal function.
+     * Should be called from a scheduler critical section.
+     *
+     * Used by condition_variable::signal() and broadcast() to
+     * implement wait morphing: instead of being resumed only to
+     * block again on this mutex, the thread waiting on the condition
+     * variable is moved to the mutex waiting list, as if it already
+     * tried to lock it, and is resumed by unlock().
+     */
+    bool
+    mutex::internal_morph_ (internal::waiting_thread_node& node)
+    {
+      thread* crt_thread = &this_thread::thread ();
+      if (internal_owner_ () != crt_thread)
+        {
+          // Signalled without holding the mutex; the thread
+          // must be resumed to contend for it.
+          return false;
+        }
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          list_.link (node);
+          node.thread_->waiting_node_ = &node;
+          // ----- Exit critical section --------------------------------------
+        }
+
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH)
+      // Keep unlock() on the slow path, which resumes the thread.
+      owner_ = reinterpret_cast<thread*> (reinterpret_cast<uintptr_t> (crt_thread)
+          | 1);
+#endif
+
+      if (protocol_ == protocol::inherit)
+        {
+          // Same as for a thread blocked in lock().
+          thread::priority_t prio = node.thread_->priority ();
+          if (prio > boosted_prio_)
+            {
+              boosted_prio_ = prio;
+            }
+
+          mutexes_list* th_list =
+              reinterpret_cast<mutexes_list*> (&crt_thread->mutexes_);
+          if (owner_links_.unlinked ())
+            {
+              th_list->link (*this);
+            }
+
+          // Boost owner priority.
+          if ((boosted_prio_ > crt_thread->priority_inherited ()))
+            {
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+              ++statistics_.boosts_;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
+              // ----- Enter uncritical section -------------------------------
+              scheduler::uncritical_section sucs;
+
+              crt_thread->priority_inherited (boosted_prio_);
+              // ----- Exit uncritical section --------------------------------
+            }
+        }
+
+#if defined(OS_TRACE_RTOS_MUTEX)
+      trace::printf ("%s() @%p %s %p %s\n", __func__, this, name (),
+                     node.thread_, node.thread_->name ());
+#endif
+      return true;
+    }
+
+#endif /* !defined(OS_USE_RTOS_PORT_MUTEX) */
+
     // Called from thread termination, in a critical section.
     void
     mutex::internal_mark_owner_dead_ (void)
@@ -833,6 +1118,13 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH)
+      if (internal_fast_lock_ (&crt_thread))
+        {
+          return result::ok;
+        }
+#endif
+
       result_t res;
         {
           // ----- Enter critical section -------------------------------------
@@ -846,6 +1138,10 @@ namespace os
           // ----- Exit critical section --------------------------------------
         }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+      clock::timestamp_t wait_begin = hrclock.now ();
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
@@ -861,6 +1157,12 @@ namespace os
               res = internal_try_lock_ (&crt_thread);
               if (res != EWOULDBLOCK)
                 {
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+                  if (res == result::ok || res == EOWNERDEAD)
+                    {
+                      internal_stats_contended_ (wait_begin);
+                    }
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
                   return res;
                 }
 
@@ -951,6 +1253,13 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH)
+      if (internal_fast_lock_ (&crt_thread))
+        {
+          return result::ok;
+        }
+#endif
+
         {
           // ----- Enter critical section -------------------------------------
           scheduler::critical_section scs;
@@ -1028,6 +1337,13 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH)
+      if (internal_fast_lock_ (&crt_thread))
+        {
+          return result::ok;
+        }
+#endif
+
       result_t res;
 
       // Extra test before entering the loop, with its inherent weight.
@@ -1044,6 +1360,10 @@ namespace os
           // ----- Exit critical section --------------------------------------
         }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+      clock::timestamp_t wait_begin = hrclock.now ();
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
       // Prepare a list node pointing to the current thread.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
@@ -1066,6 +1386,12 @@ namespace os
               res = internal_try_lock_ (&crt_thread);
               if (res != EWOULDBLOCK)
                 {
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+                  if (res == result::ok || res == EOWNERDEAD)
+                    {
+                      internal_stats_contended_ (wait_begin);
+                    }
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
                   return res;
                 }
 
@@ -1128,7 +1454,7 @@ namespace os
                   if (max_prio != thread::priority::none)
                     {
                       boosted_prio_ = max_prio;
-                      owner_->priority (boosted_prio_);
+                      internal_owner_ ()->priority (boosted_prio_);
                     }
                 }
               return res;
@@ -1184,12 +1510,19 @@ namespace os
 
       thread* crt_thread = &this_thread::thread ();
 
+#if defined(OS_USE_RTOS_MUTEX_FAST_PATH)
+      if (internal_fast_unlock_ (crt_thread))
+        {
+          return result::ok;
+        }
+#endif
+
         {
           // ----- Enter critical section -------------------------------------
           scheduler::critical_section scs;
 
           // Is the rightful owner?
-          if (owner_ == crt_thread)
+          if (internal_owner_ () == crt_thread)
             {
               if ((type_ == type::recursive) && (count_ > 1))
                 {
@@ -1203,7 +1536,7 @@ namespace os
 
               if (robustness_ != robustness::robust)
                 {
-                  --(owner_->acquired_mutexes_);
+                  --(crt_thread->acquired_mutexes_);
                 }
 
               // Remove this mutex from the thread list; ineffective if
@@ -1212,34 +1545,21 @@ namespace os
 
               if (boosted_prio_ != thread::priority::none)
                 {
-                  mutexes_list* thread_mutexes =
-                      reinterpret_cast<mutexes_list*> (&owner_->mutexes_);
+                  boosted_prio_ = thread::priority::none;
 
-                  if (thread_mutexes->empty ())
-                    {
-                      // If the owner thread has no more mutexes,
-                      // clear the inherited priority,
-                      // and the assigned priority will take precedence.
-                      boosted_prio_ = thread::priority::none;
-                    }
-                  else
-                    {
-                      // If the owner thread acquired other mutexes too,
-                      // compute the maximum boosted priority.
-                      thread::priority_t max_prio = 0;
-                      for (auto&& mx : *thread_mutexes)
-                        {
-                          if (mx.boosted_prio_ > max_prio)
-                            {
-                              max_prio = mx.boosted_prio_;
-                            }
-                        }
-                      boosted_prio_ = max_prio;
-                    }
+                  // Recompute the inherited priority from the mutexes
+                  // and read-write locks still held; if none of them
+                  // boosts the thread, the assigned priority will
+                  // take precedence.
                   // Delayed until end of critical section.
-                  owner_->priority_inherited (boosted_prio_);
+                  crt_thread->priority_inherited (
+                      crt_thread->internal_inherited_priority_ ());
                 }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+              internal_stats_released_ ();
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
               // Delayed until end of critical section.
               list_.resume_one ();
 
@@ -1464,6 +1784,118 @@ namespace os
 
     }
 
+#if defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX)
+
+    /**
+     * @details
+     * Print the acquisitions, the contention, the wait and hold
+     * times (in `hrclock` cycles) and the priority boosts.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    void
+    mutex::trace_print_statistics (void)
+    {
+#if defined(TRACE)
+      class statistics& st = statistics_;
+      trace::printf (
+          "Mutex '%s' @%p: \n"
+          "\tacquisitions: %llu, %llu contended, \n"
+          "\twait: %llu cycles, max %llu, \n"
+          "\thold: %llu cycles, max %llu, \n"
+          "\tboosts: %llu\n",
+          name (), this, static_cast<unsigned long long> (st.acquisitions_),
+          static_cast<unsigned long long> (st.contended_acquisitions_),
+          static_cast<unsigned long long> (st.wait_cycles_),
+          static_cast<unsigned long long> (st.max_wait_cycles_),
+          static_cast<unsigned long long> (st.hold_cycles_),
+          static_cast<unsigned long long> (st.max_hold_cycles_),
+          static_cast<unsigned long long> (st.boosts_));
+#endif /* defined(TRACE) */
+    }
+
+    /**
+     * @details
+     * All constructed and not yet destroyed mutexes, in the order
+     * of construction. Iterate it in a scheduler critical section,
+     * to prevent mutexes being constructed or destroyed.
+     *
+     * @par Example
+     *
+     * @code{.cpp}
+     * scheduler::critical_section scs;
+     * for (auto&& mx : mutex::statistics_mutexes ())
+     *   {
+     *     if (mx.statistics ().contended_acquisitions () > 0)
+     *       {
+     *         mx.trace_print_statistics ();
+     *       }
+     *   }
+     * @endcode
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    mutex::statistics_list&
+    mutex::statistics_mutexes (void)
+    {
+      return statistics_mutexes_;
+    }
+
+    /**
+     * @details
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    void
+    mutex::trace_print_all_statistics (void)
+    {
+      // ----- Enter critical section -----------------------------------------
+      scheduler::critical_section scs;
+
+      for (auto&& mx : statistics_mutexes_)
+        {
+          mx.trace_print_statistics ();
+        }
+      // ----- Exit critical section ------------------------------------------
+    }
+
+    /**
+     * @details
+     * The counters of a mutex currently held are cleared too,
+     * but its hold time is still accounted when released.
+     *
+     * @note This function is available only when
+     * @ref OS_INCLUDE_RTOS_STATISTICS_MUTEX
+     * is defined.
+     */
+    void
+    mutex::statistics::clear (void)
+    {
+      // ----- Enter critical section -----------------------------------------
+      scheduler::critical_section scs;
+
+      acquisitions_ = 0;
+      contended_acquisitions_ = 0;
+      wait_cycles_ = 0;
+      max_wait_cycles_ = 0;
+      hold_cycles_ = 0;
+      max_hold_cycles_ = 0;
+      boosts_ = 0;
+      // ----- Exit critical section ------------------------------------------
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_MUTEX) */
+
   // ==========================================================================
 
   /**
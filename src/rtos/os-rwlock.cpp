@@ -0,0 +1,788 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+    // ------------------------------------------------------------------------
+
+    using rwlocks_list = utils::intrusive_list<
+    rwlock, utils::double_list_links, &rwlock::owner_links_>;
+
+    /**
+     * @class rwlock::attributes
+     * @details
+     * Allow to assign a name, a clock and the maximum number
+     * of concurrent readers to the read-write lock.
+     *
+     * @par POSIX compatibility
+     *  Inspired by `pthread_rwlockattr_t` from [<pthread.h>](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  (IEEE Std 1003.1, 2013 Edition).
+     */
+
+    /**
+     * @var rwlock::count_t rwlock::attributes::rw_max_readers
+     * @details
+     * When the limit is reached, further read locks fail with `EAGAIN`.
+     */
+
+    /**
+     * @details
+     * This variable is used by the default constructor.
+     */
+    const rwlock::attributes rwlock::initializer;
+
+    // ------------------------------------------------------------------------
+
+    /**
+     * @class rwlock
+     * @details
+     * A read-write lock allows multiple threads to hold it
+     * for reading at the same time, or a single thread to hold
+     * it for writing. It is intended for read-mostly data, where
+     * a mutex would needlessly serialise the readers.
+     *
+     * @par Writer preference
+     *
+     * As soon as a writer waits for the lock, new readers are
+     * blocked, until all waiting writers got their turn; thus
+     * a continuous stream of readers cannot starve the writers.
+     * As a consequence, a thread holding the lock for reading must not
+     * request it again for reading (it may deadlock if a writer
+     * is waiting), and must not request it for writing.
+     *
+     * @par Priority inheritance
+     *
+     * Threads blocked while the lock is held for writing boost
+     * the priority of the writer, as for mutexes with the
+     * `mutex::protocol::inherit` protocol. The boost is combined
+     * with the ones required by the mutexes owned by the writer;
+     * `unlock()` drops only the boost due to this lock.
+     * Readers are not tracked individually, so they do not inherit
+     * priorities.
+     *
+     * @par Example
+     *
+     * @code{.cpp}
+     * rwlock rw;
+     *
+     * int
+     * lookup(int key)
+     * {
+     *   rw.read_lock();
+     *   int value = table[key];
+     *   rw.unlock();
+     *   return value;
+     * }
+     *
+     * void
+     * update(int key, int value)
+     * {
+     *   rw.write_lock();
+     *   table[key] = value;
+     *   rw.unlock();
+     * }
+     * @endcode
+     *
+     * @par POSIX compatibility
+     *  Inspired by `pthread_rwlock_t` from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     */
+
+    /**
+     * @details
+     * This constructor shall initialise a read-write lock object
+     * with attributes referenced by _attr_.
+     * If the attributes specified by _attr_ are modified later,
+     * the read-write lock attributes shall not be affected.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_init()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_init.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    rwlock::rwlock (const attributes& attr) :
+        rwlock
+          { nullptr, attr }
+    {
+      ;
+    }
+
+    /**
+     * @details
+     * This constructor shall initialise a named read-write lock object
+     * with attributes referenced by _attr_.
+     * If the attributes specified by _attr_ are modified later,
+     * the read-write lock attributes shall not be affected.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_init()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_init.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    rwlock::rwlock (const char* name, const attributes& attr) :
+        object_named_system
+          { name }, //
+        max_readers_ (attr.rw_max_readers)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s\n", __func__, this, this->name ());
+#endif
+
+      os_assert_throw(!interrupts::in_handler_mode (), EPERM);
+      os_assert_throw(max_readers_ > 0, EINVAL);
+
+      clock_ = attr.clock != nullptr ? attr.clock : &sysclock;
+    }
+
+    /**
+     * @details
+     * This destructor shall destroy the read-write lock object.
+     *
+     * It shall be safe to destroy an initialised read-write lock
+     * that is unlocked. Attempting to destroy a locked read-write
+     * lock results in undefined behaviour (for example it may
+     * trigger an assert).
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_destroy()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_destroy.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    rwlock::~rwlock ()
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      assert (writer_ == nullptr);
+      assert (readers_ == 0);
+      assert (readers_list_.empty ());
+      assert (writers_list_.empty ());
+    }
+
+    /**
+     * @cond ignore
+     */
+
+    /*
+     * Internal function.
+     * Should be called from a scheduler critical section.
+     */
+    result_t
+    rwlock::internal_try_read_lock_ (thread* crt_thread)
+    {
+      if (writer_ == crt_thread)
+        {
+          return EDEADLK;
+        }
+
+      if (writer_ != nullptr || writers_waiting_ > 0)
+        {
+          // Writer preference, do not pass the waiting writers.
+          return EWOULDBLOCK;
+        }
+
+      if (readers_ >= max_readers_)
+        {
+          return EAGAIN;
+        }
+
+      ++readers_;
+
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s RD %u\n", __func__, this, name (),
+                     crt_thread, crt_thread->name (), readers_);
+#endif
+      return result::ok;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from a scheduler critical section.
+     */
+    result_t
+    rwlock::internal_try_write_lock_ (thread* crt_thread)
+    {
+      if (writer_ == crt_thread)
+        {
+          return EDEADLK;
+        }
+
+      if (writer_ != nullptr || readers_ > 0)
+        {
+          return EWOULDBLOCK;
+        }
+
+      writer_ = crt_thread;
+
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s WR\n", __func__, this, name (),
+                     crt_thread, crt_thread->name ());
+#endif
+      return result::ok;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from a scheduler critical section,
+     * before the current thread blocks.
+     */
+    void
+    rwlock::internal_boost_writer_ (thread* crt_thread)
+    {
+      thread* owner = writer_;
+      if (owner == nullptr)
+        {
+          // Held by readers, which are not tracked.
+          return;
+        }
+
+      thread::priority_t prio = crt_thread->priority ();
+      if (prio > boosted_prio_)
+        {
+          boosted_prio_ = prio;
+        }
+
+      // Remember the boost in the writer, so that releasing any
+      // other lock or mutex does not drop it.
+      if (owner_links_.unlinked ())
+        {
+          rwlocks_list* th_list =
+              reinterpret_cast<rwlocks_list*> (&owner->rwlocks_);
+          th_list->link (*this);
+        }
+
+      if (prio > owner->priority_inherited ())
+        {
+          // ----- Enter uncritical section -----------------------------------
+          scheduler::uncritical_section sucs;
+
+          owner->priority_inherited (prio);
+          // ----- Exit uncritical section ------------------------------------
+        }
+    }
+
+    /*
+     * Internal function.
+     * Should be called from a scheduler critical section,
+     * when the lock or a waiting writer is released.
+     */
+    void
+    rwlock::internal_resume_waiting_ (void)
+    {
+      if (writer_ != nullptr)
+        {
+          return;
+        }
+
+      if (writers_waiting_ > 0)
+        {
+          if (readers_ == 0)
+            {
+              // Delayed until end of critical section.
+              writers_list_.resume_one ();
+            }
+        }
+      else
+        {
+          // Delayed until end of critical section.
+          readers_list_.resume_all ();
+        }
+    }
+
+    result_t
+    rwlock::internal_lock_ (bool write, clock::duration_t* timeout)
+    {
+      thread& crt_thread = this_thread::thread ();
+
+      result_t res;
+
+      // Extra test before entering the loop, with its inherent weight.
+      // Trade size for speed.
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          res =
+              write ? internal_try_write_lock_ (&crt_thread) :
+                      internal_try_read_lock_ (&crt_thread);
+          if (res != EWOULDBLOCK)
+            {
+              return res;
+            }
+
+          if (write)
+            {
+              // From now on, new readers wait.
+              ++writers_waiting_;
+            }
+          // ----- Exit critical section --------------------------------------
+        }
+
+      // Prepare a list node pointing to the current thread.
+      // Do not worry for being on stack, it is temporarily linked to the
+      // list and guaranteed to be removed before this function returns.
+      internal::waiting_thread_node node
+        { crt_thread };
+
+      internal::waiting_threads_list& list =
+          write ? writers_list_ : readers_list_;
+
+      internal::clock_timestamps_list& clock_list = clock_->steady_list ();
+      clock::timestamp_t timeout_timestamp =
+          (timeout != nullptr) ? clock_->steady_now () + *timeout : 0;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              scheduler::critical_section scs;
+
+              res =
+                  write ? internal_try_write_lock_ (&crt_thread) :
+                          internal_try_read_lock_ (&crt_thread);
+              if (res != EWOULDBLOCK)
+                {
+                  if (write)
+                    {
+                      --writers_waiting_;
+                    }
+                  return res;
+                }
+
+              internal_boost_writer_ (&crt_thread);
+
+                {
+                  // ----- Enter critical section -----------------------------
+                  interrupts::critical_section ics;
+
+                  // Add this thread to the waiting list,
+                  // and possibly to the clock timeout list.
+                  if (timeout != nullptr)
+                    {
+                      scheduler::internal_link_node (list, node, clock_list,
+                                                     timeout_node);
+                    }
+                  else
+                    {
+                      scheduler::internal_link_node (list, node);
+                    }
+                  // state::suspended set in above link().
+                  // ----- Exit critical section ------------------------------
+                }
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+          // Remove the thread from the waiting list, if not already
+          // removed by unlock(), and from the clock timeout list,
+          // if not already removed by the timer.
+          if (timeout != nullptr)
+            {
+              scheduler::internal_unlink_node (node, timeout_node);
+            }
+          else
+            {
+              scheduler::internal_unlink_node (node);
+            }
+
+          res = result::ok;
+
+          if (crt_thread.interrupted ())
+            {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+#endif
+              res = EINTR;
+            }
+          else if (timeout != nullptr
+              && clock_->steady_now () >= timeout_timestamp)
+            {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+              trace::printf ("%s() ETIMEDOUT @%p %s\n", __func__, this,
+                             name ());
+#endif
+              res = ETIMEDOUT;
+            }
+
+          if (res != result::ok)
+            {
+              // ----- Enter critical section ---------------------------------
+              scheduler::critical_section scs;
+
+              if (write)
+                {
+                  // A writer giving up may release the readers it
+                  // held back, or it may have been resumed by
+                  // unlock(), in which case another writer must
+                  // be resumed instead.
+                  --writers_waiting_;
+                  internal_resume_waiting_ ();
+                }
+
+              if (boosted_prio_ != thread::priority::none)
+                {
+                  // The boost given to the writer by this thread must
+                  // be restored to the highest priority of the
+                  // threads still waiting, if any.
+                  assert(writer_ != nullptr);
+
+                  thread::priority_t max_prio = thread::priority::none;
+
+                  for (auto&& th : readers_list_)
+                    {
+                      thread::priority_t prio = th.priority ();
+                      if (prio > max_prio)
+                        {
+                          max_prio = prio;
+                        }
+                    }
+                  for (auto&& th : writers_list_)
+                    {
+                      thread::priority_t prio = th.priority ();
+                      if (prio > max_prio)
+                        {
+                          max_prio = prio;
+                        }
+                    }
+
+                  boosted_prio_ = max_prio;
+                  if (max_prio == thread::priority::none)
+                    {
+                      owner_links_.unlink ();
+                    }
+
+                  // Recompute from the mutexes and locks still held.
+                  // Delayed until end of critical section.
+                  writer_->priority_inherited (
+                      writer_->internal_inherited_priority_ ());
+                }
+              return res;
+              // ----- Exit critical section ----------------------------------
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+    /**
+     * @endcond
+     */
+
+    /**
+     * @details
+     * Acquire the lock for reading, if it is not held by a writer
+     * and no writers are waiting for it. Otherwise, the calling
+     * thread blocks until it can acquire the read lock.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_rdlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_rdlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::read_lock (void)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s\n", __func__, this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      return internal_lock_ (false, nullptr);
+    }
+
+    /**
+     * @details
+     * Try to acquire the lock for reading as `read_lock()`, except
+     * that if the lock is held by a writer or writers are waiting
+     * for it, the call returns immediately.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_tryrdlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_tryrdlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *  <br>Differences from the standard:
+     *  - for consistency reasons, EWOULDBLOCK is used, instead of EBUSY
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::try_read_lock (void)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s\n", __func__, this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+      thread& crt_thread = this_thread::thread ();
+
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          return internal_try_read_lock_ (&crt_thread);
+          // ----- Exit critical section --------------------------------------
+        }
+    }
+
+    /**
+     * @details
+     * Acquire the lock for reading as `read_lock()`, but if the lock
+     * cannot be acquired without waiting, this wait shall be
+     * terminated when the specified timeout expires.
+     *
+     * The timeout shall expire after the number of time units (that
+     * is when the value of that clock equals or exceeds (now()+duration).
+     * The resolution of the timeout shall be the resolution of the
+     * clock on which it is based.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_timedrdlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedrdlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *  <br>Differences from the standard:
+     *  - the timeout is not expressed as an absolute time point, but
+     * as a relative number of timer ticks (by default, the SysTick
+     * clock for CMSIS).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::timed_read_lock (clock::duration_t timeout)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s(%u) @%p %s by %p %s\n", __func__,
+                     static_cast<unsigned int> (timeout), this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      return internal_lock_ (false, &timeout);
+    }
+
+    /**
+     * @details
+     * Acquire the lock for writing, if it is not held by readers
+     * or by another writer. Otherwise, the calling thread blocks
+     * until it can acquire the write lock; meanwhile, new readers
+     * are blocked too.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_wrlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_wrlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::write_lock (void)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s\n", __func__, this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      return internal_lock_ (true, nullptr);
+    }
+
+    /**
+     * @details
+     * Try to acquire the lock for writing as `write_lock()`, except
+     * that if the lock is held by readers or by another writer,
+     * the call returns immediately.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_trywrlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_trywrlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *  <br>Differences from the standard:
+     *  - for consistency reasons, EWOULDBLOCK is used, instead of EBUSY
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::try_write_lock (void)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s\n", __func__, this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+      thread& crt_thread = this_thread::thread ();
+
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          return internal_try_write_lock_ (&crt_thread);
+          // ----- Exit critical section --------------------------------------
+        }
+    }
+
+    /**
+     * @details
+     * Acquire the lock for writing as `write_lock()`, but if the lock
+     * cannot be acquired without waiting, this wait shall be
+     * terminated when the specified timeout expires.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_timedwrlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedwrlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *  <br>Differences from the standard:
+     *  - the timeout is not expressed as an absolute time point, but
+     * as a relative number of timer ticks (by default, the SysTick
+     * clock for CMSIS).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::timed_write_lock (clock::duration_t timeout)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s(%u) @%p %s by %p %s\n", __func__,
+                     static_cast<unsigned int> (timeout), this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      return internal_lock_ (true, &timeout);
+    }
+
+    /**
+     * @details
+     * If the calling thread holds the lock for writing, release it
+     * and, if it was boosted, recompute its inherited priority
+     * from the mutexes and locks it still holds. Otherwise, release
+     * one read lock.
+     *
+     * When the lock becomes free, if writers are waiting, one
+     * of them is resumed; otherwise all waiting readers are resumed.
+     *
+     * Readers are not tracked individually; releasing a read lock
+     * not held by the calling thread is not detected.
+     *
+     * @par POSIX compatibility
+     *  Inspired by [`pthread_rwlock_unlock()`](http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_unlock.html)
+     *  from [`<pthread.h>`](http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html)
+     *  ([IEEE Std 1003.1, 2013 Edition](http://pubs.opengroup.org/onlinepubs/9699919799/nframe.html)).
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    rwlock::unlock (void)
+    {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+      trace::printf ("%s() @%p %s by %p %s\n", __func__, this, name (),
+                     &this_thread::thread (), this_thread::thread ().name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+      thread* crt_thread = &this_thread::thread ();
+
+        {
+          // ----- Enter critical section -------------------------------------
+          scheduler::critical_section scs;
+
+          if (writer_ == crt_thread)
+            {
+              if (boosted_prio_ != thread::priority::none)
+                {
+                  owner_links_.unlink ();
+                  boosted_prio_ = thread::priority::none;
+
+                  // Recompute from the mutexes and locks still held,
+                  // which may require a boost of their own.
+                  // Delayed until end of critical section.
+                  crt_thread->priority_inherited (
+                      crt_thread->internal_inherited_priority_ ());
+                }
+
+              writer_ = nullptr;
+            }
+          else if (readers_ > 0)
+            {
+              --readers_;
+              if (readers_ > 0)
+                {
+                  return result::ok;
+                }
+            }
+          else
+            {
+#if defined(OS_TRACE_RTOS_RWLOCK)
+              trace::printf ("%s() EPERM @%p %s\n", __func__, this, name ());
+#endif
+              return EPERM;
+            }
+
+          internal_resume_waiting_ ();
+
+          return result::ok;
+          // ----- Exit critical section --------------------------------------
+        }
+    }
+
+  // --------------------------------------------------------------------------
+
+  } /* namespace rtos */
+} /* namespace os */
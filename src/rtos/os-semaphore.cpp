@@ -233,6 +233,7 @@ namespace os
 #else
 
       assert(list_.empty ());
+      assert(sets_list_.empty ());
 
 #endif
     }
@@ -253,6 +254,7 @@ namespace os
       // Need not be inside the critical section,
       // the list is protected by inner `resume_one()`.
       list_.resume_all ();
+      sets_list_.resume_all ();
 
 #endif /* !defined(OS_USE_RTOS_PORT_SEMAPHORE) */
     }
@@ -262,11 +264,11 @@ namespace os
      * Should be called from an interrupts critical section.
      */
     bool
-    semaphore::internal_try_wait_ (void)
+    semaphore::internal_try_wait_ (count_t n)
     {
-      if (count_ > 0)
+      if (count_ >= n)
         {
-          --count_;
+          count_ = static_cast<count_t> (count_ - n);
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
           trace::printf ("%s() @%p %s >%u\n", __func__, this, name (), count_);
 #endif
@@ -324,14 +326,57 @@ namespace os
     result_t
     semaphore::post (void)
     {
+      return post (1);
+    }
+
+    /**
+     * @details
+     * Perform a post operation on the semaphore, informing
+     * the waiting consumers that _n_ more resources are available.
+     *
+     * The count is incremented atomically; if the result would exceed
+     * max_value, the count is not changed and `EAGAIN` is returned.
+     *
+     * The waiting threads are then resumed in a single pass, in
+     * the order of the waiting list (by priority, and for
+     * equal priorities, first come, first served), as long as
+     * the units they requested fit in the new count. A thread
+     * requesting more units than left blocks the threads after it,
+     * so they cannot starve it by taking the units one by one.
+     *
+     * This is intended for interrupt handlers releasing many
+     * resources at once, like the buffers of a DMA transfer, which
+     * otherwise would call `post()` in a loop, entering a critical
+     * section and possibly resuming a thread on each call.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     *
+     * @warning Applications using these functions may be subject to priority inversion.
+     */
+    result_t
+    semaphore::post (count_t n)
+    {
+      os_assert_err(n > 0, EINVAL);
 
 #if defined(OS_USE_RTOS_PORT_SEMAPHORE)
 
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+      trace::printf ("%s(%u) @%p %s\n", __func__, n, this, name ());
 #endif
 
-      return port::semaphore::post (this);
+      // The port has no batched post; the units are posted one by one.
+      for (count_t i = 0; i < n; ++i)
+        {
+          result_t res = port::semaphore::post (this);
+          if (res != result::ok)
+            {
+              return res;
+            }
+        }
+      return result::ok;
 
 #else
 
@@ -341,24 +386,27 @@ namespace os
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
-          if (count_ >= this->max_value_)
+          if (n > this->max_value_ - count_)
             {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-              trace::printf ("%s() @%p %s EAGAIN\n", __func__, this, name ());
+              trace::printf ("%s(%u) @%p %s EAGAIN\n", __func__, n, this,
+                             name ());
 #endif
               return EAGAIN;
             }
 
-          ++count_;
+          count_ = static_cast<count_t> (count_ + n);
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-          trace::printf ("%s() @%p %s count %u\n", __func__, this, name (),
-                         count_);
+          trace::printf ("%s(%u) @%p %s count %u\n", __func__, n, this,
+                         name (), count_);
 #endif
           // ----- Exit critical section --------------------------------------
         }
 
-      // Wake-up one thread.
-      list_.resume_one ();
+      // Wake-up as many threads as the new count allows, and
+      // the wait sets, which request no units.
+      list_.resume_counted (static_cast<std::size_t> (count_));
+      sets_list_.resume_all ();
 
       return result::ok;
 
@@ -396,16 +444,47 @@ namespace os
     result_t
     semaphore::wait ()
     {
+      return wait (1);
+    }
+
+    /**
+     * @details
+     * Perform a lock operation of _n_ units on the semaphore.
+     *
+     * If the current value is at least _n_, it is decremented by _n_,
+     * and the call returns immediately. Otherwise the calling
+     * thread waits until `post()` makes enough units available
+     * for it; the units are taken all at once, never partially.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     *
+     * @warning Applications using these functions may be subject to priority inversion.
+     */
+    result_t
+    semaphore::wait (count_t n)
+    {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-      trace::printf ("%s() @%p %s <%u\n", __func__, this, name (), count_);
+      trace::printf ("%s(%u) @%p %s <%u\n", __func__, n, this, name (),
+                     count_);
 #endif
 
       os_assert_err(!interrupts::in_handler_mode (), EPERM);
       os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(n > 0 && n <= max_value_, EINVAL);
 
 #if defined(OS_USE_RTOS_PORT_SEMAPHORE)
 
-      return port::semaphore::wait (this);
+      if (n == 1)
+        {
+          return port::semaphore::wait (this);
+        }
+
+      // The port has no batched wait, and partial locks
+      // cannot be undone atomically.
+      return ENOTSUP;
 
 #else
 
@@ -415,7 +494,7 @@ namespace os
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
-          if (internal_try_wait_ ())
+          if (internal_try_wait_ (n))
             {
               return result::ok;
             }
@@ -424,11 +503,12 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
-      // Prepare a list node pointing to the current thread.
+      // Prepare a list node pointing to the current thread, with
+      // the requested units, used by `post()` to decide whom to resume.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_request_node node
+        { crt_thread, static_cast<std::size_t> (n) };
 
       for (;;)
         {
@@ -436,7 +516,7 @@ namespace os
               // ----- Enter critical section ---------------------------------
               interrupts::critical_section ics;
 
-              if (internal_try_wait_ ())
+              if (internal_try_wait_ (n))
                 {
                   return result::ok;
                 }
@@ -456,8 +536,12 @@ namespace os
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+              trace::printf ("%s(%u) EINTR @%p %s\n", __func__, n, this,
+                             name ());
 #endif
+              // The units possibly reserved for this thread
+              // go to the next waiting threads.
+              list_.resume_counted (static_cast<std::size_t> (value ()));
               return EINTR;
             }
         }
@@ -491,15 +575,42 @@ namespace os
     result_t
     semaphore::try_wait ()
     {
+      return try_wait (1);
+    }
+
+    /**
+     * @details
+     * Perform a lock operation of _n_ units only if the semaphore
+     * value is at least _n_; otherwise the count is not changed.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @note Can be invoked from Interrupt Service Routines.
+     *
+     * @warning Applications using these functions may be subject to priority inversion.
+     */
+    result_t
+    semaphore::try_wait (count_t n)
+    {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-      trace::printf ("%s() @%p %s <%u\n", __func__, this, name (), count_);
+      trace::printf ("%s(%u) @%p %s <%u\n", __func__, n, this, name (),
+                     count_);
 #endif
 
       assert(port::interrupts::is_priority_valid ());
+      os_assert_err(n > 0 && n <= max_value_, EINVAL);
 
 #if defined(OS_USE_RTOS_PORT_SEMAPHORE)
 
-      return port::semaphore::try_wait (this);
+      if (n == 1)
+        {
+          return port::semaphore::try_wait (this);
+        }
+
+      // The port has no batched wait, and partial locks
+      // cannot be undone atomically.
+      return ENOTSUP;
 
 #else
 
@@ -507,7 +618,7 @@ namespace os
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
-          if (internal_try_wait_ ())
+          if (internal_try_wait_ (n))
             {
               return result::ok;
             }
@@ -560,18 +671,45 @@ namespace os
     result_t
     semaphore::timed_wait (clock::duration_t timeout)
     {
+      return timed_wait (1, timeout);
+    }
+
+    /**
+     * @details
+     * Perform a lock operation of _n_ units on the semaphore, as
+     * `wait(count_t)`, but terminate the wait when the timeout
+     * expires. The units are taken all at once, never partially.
+     *
+     * @par POSIX compatibility
+     *  Extension to standard, no POSIX similar functionality identified.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     *
+     * @warning Applications using these functions may be subject to priority inversion.
+     */
+    result_t
+    semaphore::timed_wait (count_t n, clock::duration_t timeout)
+    {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-      trace::printf ("%s(%u) @%p %s <%u\n", __func__,
+      trace::printf ("%s(%u,%u) @%p %s <%u\n", __func__, n,
                      static_cast<unsigned int> (timeout), this, name (),
                      count_);
 #endif
 
       os_assert_err(!interrupts::in_handler_mode (), EPERM);
       os_assert_err(!scheduler::locked (), EPERM);
+      os_assert_err(n > 0 && n <= max_value_, EINVAL);
 
 #if defined(OS_USE_RTOS_PORT_SEMAPHORE)
 
-      return port::semaphore::timed_wait (this, timeout);
+      if (n == 1)
+        {
+          return port::semaphore::timed_wait (this, timeout);
+        }
+
+      // The port has no batched wait, and partial locks
+      // cannot be undone atomically.
+      return ENOTSUP;
 
 #else
 
@@ -581,7 +719,7 @@ namespace os
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
-          if (internal_try_wait_ ())
+          if (internal_try_wait_ (n))
             {
               return result::ok;
             }
@@ -590,11 +728,12 @@ namespace os
 
       thread& crt_thread = this_thread::thread ();
 
-      // Prepare a list node pointing to the current thread.
+      // Prepare a list node pointing to the current thread, with
+      // the requested units, used by `post()` to decide whom to resume.
       // Do not worry for being on stack, it is temporarily linked to the
       // list and guaranteed to be removed before this function returns.
-      internal::waiting_thread_node node
-        { crt_thread };
+      internal::waiting_request_node node
+        { crt_thread, static_cast<std::size_t> (n) };
 
       internal::clock_timestamps_list& clock_list = clock_->steady_list ();
       clock::timestamp_t timeout_timestamp = clock_->steady_now () + timeout;
@@ -609,7 +748,7 @@ namespace os
               // ----- Enter critical section ---------------------------------
               interrupts::critical_section ics;
 
-              if (internal_try_wait_ ())
+              if (internal_try_wait_ (n))
                 {
                   return result::ok;
                 }
@@ -632,20 +771,24 @@ namespace os
           if (crt_thread.interrupted ())
             {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-              trace::printf ("%s(%u) EINTR @%p %s\n", __func__,
+              trace::printf ("%s(%u,%u) EINTR @%p %s\n", __func__, n,
                              static_cast<unsigned int> (timeout), this,
                              name ());
 #endif
+              // The units possibly reserved for this thread
+              // go to the next waiting threads.
+              list_.resume_counted (static_cast<std::size_t> (value ()));
               return EINTR;
             }
 
           if (clock_->steady_now () >= timeout_timestamp)
             {
 #if defined(OS_TRACE_RTOS_SEMAPHORE)
-              trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__,
+              trace::printf ("%s(%u,%u) ETIMEDOUT @%p %s\n", __func__, n,
                              static_cast<unsigned int> (timeout), this,
                              name ());
 #endif
+              list_.resume_counted (static_cast<std::size_t> (value ()));
               return ETIMEDOUT;
             }
         }
@@ -53,6 +53,9 @@ namespace os
     using mutexes_list = utils::intrusive_list<
     mutex, utils::double_list_links, &mutex::owner_links_>;
 
+    using rwlocks_list = utils::intrusive_list<
+    rwlock, utils::double_list_links, &rwlock::owner_links_>;
+
     // ========================================================================
     /**
      * @class thread::attributes
@@ -428,6 +431,10 @@ namespace os
 
           // Get attributes from user structure.
           prio_assigned_ = attr.th_priority;
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+          quantum_ticks_ = attr.th_quantum_ticks;
+          quantum_left_ = quantum_ticks_;
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
 
           func_ = function;
           func_args_ = args;
@@ -529,6 +536,10 @@ namespace os
 
 #if defined(OS_USE_RTOS_PORT_SCHEDULER)
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+      evtrace::record_event (evtrace::event::thread_resume, this);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
         {
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
@@ -546,12 +557,7 @@ namespace os
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
-          // If the thread is not already in the ready list, enqueue it.
-          if (ready_node_.next () == nullptr)
-            {
-              scheduler::ready_threads_list_.link (ready_node_);
-              // state::ready set in above link().
-            }
+          internal_link_ready_ ();
           // ----- Exit critical section --------------------------------------
         }
 
@@ -561,6 +567,33 @@ namespace os
 
     }
 
+#if !defined(OS_USE_RTOS_PORT_SCHEDULER)
+
+    /**
+     * @details
+     * Common part of `resume()` and of the clock batched expiry,
+     * which resumes the threads without invoking the scheduler
+     * for each of them.
+     *
+     * Must be called in an interrupts critical section.
+     */
+    void
+    thread::internal_link_ready_ (void)
+    {
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+      evtrace::record_event (evtrace::event::thread_resume, this);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
+      // If the thread is not already in the ready list, enqueue it.
+      if (ready_node_.next () == nullptr)
+        {
+          scheduler::ready_threads_list_.link (ready_node_);
+          // state::ready set in above link().
+        }
+    }
+
+#endif /* !defined(OS_USE_RTOS_PORT_SCHEDULER) */
+
     /**
      * @details
      *
@@ -659,7 +692,7 @@ namespace os
 
           // Remove from initial location and reinsert according
           // to new priority.
-          ready_node_.unlink ();
+          scheduler::ready_threads_list_.unlink (ready_node_);
           scheduler::ready_threads_list_.link (ready_node_);
           // ----- Exit critical section --------------------------------------
         }
@@ -730,7 +763,7 @@ namespace os
 
           // Remove from initial location and reinsert according
           // to new priority.
-          ready_node_.unlink ();
+          scheduler::ready_threads_list_.unlink (ready_node_);
           scheduler::ready_threads_list_.link (ready_node_);
           // ----- Exit critical section --------------------------------------
         }
@@ -952,7 +985,11 @@ namespace os
               // ----- Enter critical section ---------------------------------
               interrupts::critical_section ics;
 
+#if !defined(OS_USE_RTOS_PORT_SCHEDULER)
+              scheduler::ready_threads_list_.unlink (ready_node_);
+#else
               ready_node_.unlink ();
+#endif
 
               child_links_.unlink ();
               // ----- Exit critical section ----------------------------------
@@ -1018,6 +1055,41 @@ namespace os
         }
     }
 
+    /*
+     * Both mutexes and read-write locks boost the holder, and each
+     * keeps the highest priority of its own waiters; the thread
+     * inherits the maximum of them. Releasing one of them must
+     * recompute it from all the others, otherwise the boost still
+     * required by another object would be lost.
+     *
+     * Should be called from a scheduler critical section.
+     */
+    thread::priority_t
+    thread::internal_inherited_priority_ (void)
+    {
+      priority_t max_prio = priority::none;
+
+      mutexes_list* mx_list = reinterpret_cast<mutexes_list*> (&mutexes_);
+      for (auto&& mx : *mx_list)
+        {
+          if (mx.boosted_prio_ > max_prio)
+            {
+              max_prio = mx.boosted_prio_;
+            }
+        }
+
+      rwlocks_list* rw_list = reinterpret_cast<rwlocks_list*> (&rwlocks_);
+      for (auto&& rw : *rw_list)
+        {
+          if (rw.boosted_prio_ > max_prio)
+            {
+              max_prio = rw.boosted_prio_;
+            }
+        }
+
+      return max_prio;
+    }
+
     // Called from kill() and from idle thread.
     void
     thread::internal_destroy_ (void)
@@ -1100,7 +1172,11 @@ namespace os
               interrupts::critical_section ics;
 
               // Remove thread from the funeral list and kill it here.
+#if !defined(OS_USE_RTOS_PORT_SCHEDULER)
+              scheduler::ready_threads_list_.unlink (ready_node_);
+#else
               ready_node_.unlink ();
+#endif
 
               // If the thread is waiting on an event, remove it from the list.
               if (waiting_node_ != nullptr)
@@ -1108,6 +1184,14 @@ namespace os
                   waiting_node_->unlink ();
                 }
 
+              // If the thread is waiting on a set, remove it from all lists.
+              if (waiting_set_ != nullptr)
+                {
+                  waiting_set_->internal_unlink_ ();
+                  waiting_set_->waiter_ = nullptr;
+                  waiting_set_ = nullptr;
+                }
+
               // If the thread is waiting on a timeout, remove it from the list.
               if (clock_node_ != nullptr)
                 {
@@ -1494,6 +1578,10 @@ namespace os
        * @details
        * Pass control to next thread that is in \b READY state.
        *
+       * When `OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN` is defined, the
+       * rest of the time slice is given up and the thread is
+       * moved behind the ready threads with the same priority.
+       *
        * @warning Cannot be invoked from Interrupt Service Routines.
        */
       void
@@ -1519,6 +1607,12 @@ namespace os
 
 #else
 
+#if defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN)
+        // Give up the rest of the time slice, to be moved
+        // behind the threads with the same priority.
+        _thread ()->quantum_left_ = 0;
+#endif /* defined(OS_INCLUDE_RTOS_THREAD_ROUND_ROBIN) */
+
         port::scheduler::reschedule ();
 
 #endif
@@ -181,8 +181,15 @@ namespace os
       func_ = function;
       func_args_ = args;
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+      in_isr_ = attr.tm_in_isr;
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
 #if !defined(OS_USE_RTOS_PORT_TIMER)
       clock_ = attr.clock != nullptr ? attr.clock : &sysclock;
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+      slack_ = attr.tm_slack;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
 #endif
 
 #if defined(OS_USE_RTOS_PORT_TIMER)
@@ -225,7 +232,7 @@ namespace os
 
           if (state_ == state::running)
             {
-              timer_node_.unlink ();
+              internal_unlink_ ();
             }
           // ----- Exit critical section --------------------------------------
         }
@@ -265,14 +272,20 @@ namespace os
 
       period_ = period;
 
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+      // Keep the exact time stamp, to re-arm periodic timers without drift.
+      nominal_ = clock_->steady_now () + period;
+      timer_node_.timestamp = clock::coalesce (nominal_, slack_);
+#else
       timer_node_.timestamp = clock_->steady_now () + period;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
 
         {
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
           // If started, stop.
-          timer_node_.unlink ();
+          internal_unlink_ ();
 
           clock_->steady_list ().link (timer_node_);
           // ----- Exit critical section --------------------------------------
@@ -323,7 +336,7 @@ namespace os
           // ----- Enter critical section -------------------------------------
           interrupts::critical_section ics;
 
-          timer_node_.unlink ();
+          internal_unlink_ ();
           // ----- Exit critical section --------------------------------------
         }
       res = result::ok;
@@ -344,10 +357,43 @@ namespace os
     timer::internal_interrupt_service_routine (void)
     {
 
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+      evtrace::record_event (evtrace::event::timer_expire, this);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+
+      if (!in_isr_ && (timer_daemon::thread_ != nullptr))
+        {
+          // Defer the function to the timer daemon thread; it also
+          // re-arms periodic timers.
+          timer_daemon::pending_list_.link (timer_node_);
+          pending_ = true;
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON)
+          if (++timer_daemon::statistics::queue_depth_
+              > timer_daemon::statistics::max_queue_depth_)
+            {
+              timer_daemon::statistics::max_queue_depth_ =
+                  timer_daemon::statistics::queue_depth_;
+            }
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON) */
+
+          timer_daemon::thread_->flags_raise (timer_daemon::flag);
+          return;
+        }
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
       if (type_ == run::periodic)
         {
           // Re-arm the timer for the next period.
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+          nominal_ += period_;
+          timer_node_.timestamp = clock::coalesce (nominal_, slack_);
+#else
           timer_node_.timestamp += period_;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
 
           // No need for critical section in ISR.
           clock_->steady_list ().link (timer_node_);
@@ -365,13 +411,230 @@ namespace os
       func_ (func_args_);
     }
 
+    /**
+     * @details
+     * Remove the timer node from the clock list or, when it expired
+     * but was not yet dispatched, from the timer daemon pending list.
+     *
+     * Must be called in a critical section.
+     */
+    void
+    timer::internal_unlink_ (void)
+    {
+      timer_node_.unlink ();
+
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+      if (pending_)
+        {
+          pending_ = false;
+#if defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON)
+          --timer_daemon::statistics::queue_depth_;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON) */
+        }
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+    }
+
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON)
+
+    /**
+     * @details
+     * Called by the timer daemon for a timer removed from the
+     * pending list, in a critical section. The periodic timers are
+     * re-armed relative to the previous time stamp, so late
+     * dispatches do not accumulate drift.
+     */
+    void
+    timer::internal_dispatch_ (void)
+    {
+#if defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON)
+      clock::duration_t delay =
+          static_cast<clock::duration_t> (clock_->steady_now ()
+              - timer_node_.timestamp);
+      if (delay > timer_daemon::statistics::max_dispatch_delay_)
+        {
+          timer_daemon::statistics::max_dispatch_delay_ = delay;
+        }
+      --timer_daemon::statistics::queue_depth_;
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON) */
+      pending_ = false;
+
+      if (type_ == run::periodic)
+        {
+          // Re-arm the timer for the next period.
+#if defined(OS_INCLUDE_RTOS_CLOCK_SLACK)
+          nominal_ += period_;
+          timer_node_.timestamp = clock::coalesce (nominal_, slack_);
+#else
+          timer_node_.timestamp += period_;
+#endif /* defined(OS_INCLUDE_RTOS_CLOCK_SLACK) */
+          clock_->steady_list ().link (timer_node_);
+        }
+      else
+        {
+          state_ = state::completed;
+        }
+    }
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
   /**
    * @endcond
    */
 
 #endif
 
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * @details
+   * When `OS_INCLUDE_RTOS_TIMER_DAEMON` is defined, the clock
+   * interrupt only moves the expired timers to a list and
+   * notifies the timer daemon, a thread running with
+   * `OS_INTEGER_RTOS_TIMER_DAEMON_PRIORITY`, which calls
+   * the timer functions, in expiry order, in batches.
+   *
+   * Timers created with `tm_in_isr` still call their functions
+   * in the clock interrupt.
+   */
+  namespace timer_daemon
+  {
+    /**
+     * @cond ignore
+     */
+
+#pragma GCC diagnostic push
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wexit-time-destructors"
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+
+    internal::timer_nodes_list pending_list_;
+
+#pragma GCC diagnostic pop
+
+    rtos::thread* thread_;
+
+#if defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON)
+
+    namespace statistics
+    {
+      std::size_t queue_depth_;
+      std::size_t max_queue_depth_;
+      clock::duration_t max_dispatch_delay_;
+    } /* namespace statistics */
+
+#endif /* defined(OS_INCLUDE_RTOS_STATISTICS_TIMER_DAEMON) */
+
+    void*
+    internal_run (void* args __attribute__((unused)))
+    {
+      while (true)
+        {
+          this_thread::flags_wait (flag);
+
+          // Dispatch all pending timers, in order.
+          while (true)
+            {
+              timer* tm;
+                {
+                  // ----- Enter critical section -----------------------------
+                  interrupts::critical_section ics;
+
+                  if (pending_list_.empty ())
+                    {
+                      break;
+                    }
+                  internal::timer_node* node =
+                      const_cast<internal::timer_node*> (pending_list_.head ());
+                  node->unlink ();
+
+                  tm = &node->tmr;
+                  tm->internal_dispatch_ ();
+                  // ----- Exit critical section ------------------------------
+                }
+
+              // Call the user function, with interrupts enabled.
+              tm->func_ (tm->func_args_);
+            }
+        }
+
+      /* NOTREACHED */
+      return nullptr;
+    }
+
+  /**
+   * @endcond
+   */
+
+  } /* namespace timer_daemon */
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
+
   // --------------------------------------------------------------------------
 
   } /* namespace rtos */
 } /* namespace os */
+
+#if defined(OS_INCLUDE_RTOS_TIMER_DAEMON) \
+    && !defined(OS_USE_RTOS_PORT_TIMER)
+
+// ----------------------------------------------------------------------------
+
+using namespace os;
+using namespace os::rtos;
+
+#pragma GCC diagnostic push
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wexit-time-destructors"
+#pragma clang diagnostic ignored "-Wglobal-constructors"
+#endif
+
+#if defined(OS_EXCLUDE_DYNAMIC_MEMORY_ALLOCATIONS)
+
+static thread::attributes
+timer_daemon_attributes (void)
+{
+  thread::attributes attr;
+  attr.th_priority = OS_INTEGER_RTOS_TIMER_DAEMON_PRIORITY;
+  return attr;
+}
+
+static thread_inclusive<OS_INTEGER_RTOS_TIMER_DAEMON_STACK_SIZE_BYTES> os_timer_daemon_thread_
+  { "timer", timer_daemon::internal_run, nullptr, timer_daemon_attributes () };
+
+#else
+
+static std::unique_ptr<thread> os_timer_daemon_thread_;
+
+#endif /* defined(OS_EXCLUDE_DYNAMIC_MEMORY_ALLOCATIONS) */
+
+#pragma GCC diagnostic pop
+
+void
+__attribute__((weak))
+os_startup_create_thread_timer_daemon (void)
+{
+#if defined(OS_EXCLUDE_DYNAMIC_MEMORY_ALLOCATIONS)
+
+  // The thread object instance was created by the static constructors.
+  timer_daemon::thread_ = &os_timer_daemon_thread_;
+
+#else
+
+  thread::attributes attr = thread::initializer;
+  attr.th_stack_size_bytes = OS_INTEGER_RTOS_TIMER_DAEMON_STACK_SIZE_BYTES;
+  attr.th_priority = OS_INTEGER_RTOS_TIMER_DAEMON_PRIORITY;
+
+  // No need for an explicit delete, it is deallocated by the unique_ptr.
+  os_timer_daemon_thread_ = std::unique_ptr<thread> (
+      new thread ("timer", timer_daemon::internal_run, nullptr, attr));
+
+  timer_daemon::thread_ = os_timer_daemon_thread_.get ();
+
+#endif /* defined(OS_EXCLUDE_DYNAMIC_MEMORY_ALLOCATIONS) */
+}
+
+#endif /* defined(OS_INCLUDE_RTOS_TIMER_DAEMON) */
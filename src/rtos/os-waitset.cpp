@@ -0,0 +1,684 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+
+// ----------------------------------------------------------------------------
+
+namespace os
+{
+  namespace rtos
+  {
+    // ------------------------------------------------------------------------
+
+    /**
+     * @class wait_set
+     * @details
+     * A wait set allows a single thread to block on several
+     * synchronisation objects at once (semaphores, message queues,
+     * memory pools, event flags and the thread flags), and to
+     * learn which of them became ready, like `poll()`.
+     *
+     * While waiting, the thread is linked, with one node per object,
+     * into the waiting lists of all objects; the first object which
+     * resumes it wakes it up, and the thread removes itself from all
+     * the other lists.
+     *
+     * The objects are only checked, not consumed; after `wait_any()`
+     * returns, the ready object must be used with its non-blocking
+     * function (like `semaphore::try_wait()` or
+     * `message_queue::try_receive()`). If more objects are ready,
+     * the one with the lowest index is reported, so the order
+     * in which objects are added gives their priority.
+     *
+     * Since waking up a thread that does not consume the object may
+     * delay other threads waiting on the same object, objects in a
+     * wait set should be waited only by the thread using the set.
+     *
+     * A wait set can be used by a single thread at a time.
+     *
+     * @par Example
+     *
+     * @code{.cpp}
+     * wait_set ws;
+     * ws.add (sem);            // index 0
+     * ws.add (mq);             // index 1
+     * ws.add_thread_flags (1); // index 2
+     *
+     * for (;;)
+     *   {
+     *     wait_set::index_t index;
+     *     ws.wait_any (&index);
+     *     if (index == 0)
+     *       sem.try_wait ();
+     *     else if (index == 1)
+     *       mq.try_receive (&msg, sizeof (msg));
+     *     else
+     *       break;
+     *   }
+     * @endcode
+     *
+     * @warning The objects must not be destroyed while in the set.
+     */
+
+    /**
+     * @details
+     * Construct an empty wait set.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    wait_set::wait_set () :
+        wait_set
+          { nullptr }
+    {
+      ;
+    }
+
+    /**
+     * @details
+     * Construct an empty named wait set.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    wait_set::wait_set (const char* name) :
+        object_named
+          { name }
+    {
+#if defined(OS_TRACE_RTOS_WAITSET)
+      trace::printf ("%s() @%p %s\n", __func__, this, this->name ());
+#endif
+
+      os_assert_throw(!interrupts::in_handler_mode (), EPERM);
+    }
+
+    /**
+     * @details
+     * It shall be safe to destroy a wait set upon which no
+     * thread is currently blocked.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    wait_set::~wait_set ()
+    {
+#if defined(OS_TRACE_RTOS_WAITSET)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      assert (waiter_ == nullptr);
+    }
+
+    /**
+     * @cond ignore
+     */
+
+    result_t
+    wait_set::internal_add_ (void* object, uint8_t kind, flags::mask_t mask,
+                             flags::mode_t mode)
+    {
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+      // ----- Enter critical section -----------------------------------------
+      interrupts::critical_section ics;
+
+      if (waiter_ != nullptr)
+        {
+          return EPERM;
+        }
+
+      if (count_ >= max_objects)
+        {
+          return EAGAIN;
+        }
+
+      entry& e = entries_[count_];
+      e.object = object;
+      e.kind = kind;
+      e.node.mask_ = mask;
+      // Objects are not consumed by the set.
+      e.node.mode_ = mode & ~flags::mode::clear;
+
+      ++count_;
+
+      return result::ok;
+      // ----- Exit critical section ------------------------------------------
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    bool
+    wait_set::internal_ready_ (index_t* index)
+    {
+      for (index_t i = 0; i < count_; ++i)
+        {
+          entry& e = entries_[i];
+          bool ready = false;
+          switch (e.kind)
+            {
+            case kind::semaphore:
+              ready = (static_cast<semaphore*> (e.object)->value () > 0);
+              break;
+
+            case kind::message_queue:
+              ready = !static_cast<message_queue*> (e.object)->empty ();
+              break;
+
+            case kind::memory_pool:
+              ready = !static_cast<memory_pool*> (e.object)->full ();
+              break;
+
+#if !defined(OS_USE_RTOS_PORT_EVENT_FLAGS)
+            case kind::event_flags:
+              ready =
+                  static_cast<event_flags*> (e.object)->event_flags_.check_raised (
+                      e.node.mask_, nullptr, e.node.mode_);
+              break;
+#endif
+
+            case kind::thread_flags:
+              ready = this_thread::thread ().event_flags_.check_raised (
+                  e.node.mask_, nullptr, e.node.mode_);
+              break;
+
+            default:
+              break;
+            }
+
+          if (ready)
+            {
+              if (index != nullptr)
+                {
+                  *index = i;
+                }
+              return true;
+            }
+        }
+      return false;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    void
+    wait_set::internal_link_ (thread& th)
+    {
+      for (index_t i = 0; i < count_; ++i)
+        {
+          entry& e = entries_[i];
+          internal::waiting_threads_list* list = nullptr;
+          switch (e.kind)
+            {
+#if !defined(OS_USE_RTOS_PORT_SEMAPHORE)
+            case kind::semaphore:
+              list = &static_cast<semaphore*> (e.object)->sets_list_;
+              break;
+#endif
+
+#if !defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+            case kind::message_queue:
+              list = &static_cast<message_queue*> (e.object)->sets_list_;
+              break;
+#endif
+
+#if !defined(OS_USE_RTOS_PORT_MEMORY_POOL)
+            case kind::memory_pool:
+              list = &static_cast<memory_pool*> (e.object)->sets_list_;
+              break;
+#endif
+
+#if !defined(OS_USE_RTOS_PORT_EVENT_FLAGS)
+            case kind::event_flags:
+              list = &static_cast<event_flags*> (e.object)->list_;
+              break;
+#endif
+
+            default:
+              // The thread flags resume the thread directly.
+              break;
+            }
+
+          e.node.thread_ = &th;
+          e.node.satisfied_ = false;
+          if (list != nullptr)
+            {
+              list->link (e.node);
+            }
+        }
+
+      th.waiting_set_ = this;
+    }
+
+    /*
+     * Internal function.
+     * Should be called from an interrupts critical section.
+     */
+    void
+    wait_set::internal_unlink_ (void)
+    {
+      for (index_t i = 0; i < count_; ++i)
+        {
+          // Nodes not linked, or already removed by the
+          // object which resumed the thread, are ignored.
+          entries_[i].node.unlink ();
+        }
+    }
+
+    /**
+     * @endcond
+     */
+
+    /**
+     * @details
+     * The semaphore is ready when its value is positive, and
+     * `semaphore::try_wait()` would succeed.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::add (semaphore& sem)
+    {
+#if defined(OS_USE_RTOS_PORT_SEMAPHORE)
+      return ENOTSUP;
+#else
+      // The set requests no units; it is linked to the separate
+      // list of the semaphore, resumed by every `post()`.
+      return internal_add_ (&sem, kind::semaphore, 0, 0);
+#endif
+    }
+
+    /**
+     * @details
+     * The message queue is ready when it is not empty, and
+     * `message_queue::try_receive()` would succeed.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::add (message_queue& mq)
+    {
+#if defined(OS_USE_RTOS_PORT_MESSAGE_QUEUE)
+      return ENOTSUP;
+#else
+      return internal_add_ (&mq, kind::message_queue, 0, 0);
+#endif
+    }
+
+    /**
+     * @details
+     * The memory pool is ready when it is not full, and
+     * `memory_pool::try_alloc()` would succeed.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::add (memory_pool& mp)
+    {
+#if defined(OS_USE_RTOS_PORT_MEMORY_POOL)
+      return ENOTSUP;
+#else
+      return internal_add_ (&mp, kind::memory_pool, 0, 0);
+#endif
+    }
+
+    /**
+     * @details
+     * The event flags object is ready when the expected flags are
+     * raised, and `event_flags::try_wait()` with the same mask
+     * would succeed. The flags are not cleared by the wait set.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::add (event_flags& evf, flags::mask_t mask, flags::mode_t mode)
+    {
+#if defined(OS_USE_RTOS_PORT_EVENT_FLAGS)
+      return ENOTSUP;
+#else
+      return internal_add_ (&evf, kind::event_flags, mask, mode);
+#endif
+    }
+
+    /**
+     * @details
+     * The flags of the thread calling `wait_any()` are ready when
+     * the expected flags are raised, and `this_thread::flags_try_wait()`
+     * with the same mask would succeed. The flags are not cleared
+     * by the wait set.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::add_thread_flags (flags::mask_t mask, flags::mode_t mode)
+    {
+      return internal_add_ (nullptr, kind::thread_flags, mask, mode);
+    }
+
+    /**
+     * @details
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::clear (void)
+    {
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+      // ----- Enter critical section -----------------------------------------
+      interrupts::critical_section ics;
+
+      if (waiter_ != nullptr)
+        {
+          return EPERM;
+        }
+
+      count_ = 0;
+
+      return result::ok;
+      // ----- Exit critical section ------------------------------------------
+    }
+
+    /**
+     * @details
+     * If one of the objects is ready, return its index immediately.
+     * Otherwise link the thread into the waiting lists of all objects
+     * and suspend it until one of them is ready.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::wait_any (index_t* index)
+    {
+#if defined(OS_TRACE_RTOS_WAITSET)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      if (count_ == 0)
+        {
+          return EINVAL;
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          if (waiter_ != nullptr)
+            {
+              return EPERM;
+            }
+          waiter_ = &crt_thread;
+          // ----- Exit critical section --------------------------------------
+        }
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              if (internal_ready_ (index))
+                {
+                  waiter_ = nullptr;
+#if defined(OS_TRACE_RTOS_WAITSET)
+                  trace::printf (
+                      "%s() @%p %s >%u\n", __func__, this, name (),
+                      static_cast<unsigned int> (index != nullptr ? *index : 0));
+#endif
+                  return result::ok;
+                }
+
+              // Remove this thread from the ready list, if there.
+              port::this_thread::prepare_suspend ();
+
+              // Add this thread to the waiting lists of all objects.
+              internal_link_ (crt_thread);
+
+              crt_thread.state_ = thread::state::suspended;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+              evtrace::record_event (evtrace::event::wait_begin, this);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              // Remove the thread from all waiting lists,
+              // except the one which resumed it.
+              internal_unlink_ ();
+              crt_thread.waiting_set_ = nullptr;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+              evtrace::record_event (evtrace::event::wait_end, 0u);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+              // ----- Exit critical section ----------------------------------
+            }
+
+          if (crt_thread.interrupted ())
+            {
+              waiter_ = nullptr;
+#if defined(OS_TRACE_RTOS_WAITSET)
+              trace::printf ("%s() EINTR @%p %s\n", __func__, this, name ());
+#endif
+              return EINTR;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+    /**
+     * @details
+     * Check the objects without blocking.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::try_wait_any (index_t* index)
+    {
+#if defined(OS_TRACE_RTOS_WAITSET)
+      trace::printf ("%s() @%p %s\n", __func__, this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+
+      if (count_ == 0)
+        {
+          return EINVAL;
+        }
+
+      // ----- Enter critical section -----------------------------------------
+      interrupts::critical_section ics;
+
+      if (internal_ready_ (index))
+        {
+          return result::ok;
+        }
+
+      return EWOULDBLOCK;
+      // ----- Exit critical section ------------------------------------------
+    }
+
+    /**
+     * @details
+     * Same as `wait_any()`, but the wait is limited to _timeout_
+     * ticks of the system clock.
+     *
+     * @warning Cannot be invoked from Interrupt Service Routines.
+     */
+    result_t
+    wait_set::timed_wait_any (clock::duration_t timeout, index_t* index)
+    {
+#if defined(OS_TRACE_RTOS_WAITSET)
+      trace::printf ("%s(%u) @%p %s\n", __func__,
+                     static_cast<unsigned int> (timeout), this, name ());
+#endif
+
+      os_assert_err(!interrupts::in_handler_mode (), EPERM);
+      os_assert_err(!scheduler::locked (), EPERM);
+
+      if (count_ == 0)
+        {
+          return EINVAL;
+        }
+
+      thread& crt_thread = this_thread::thread ();
+
+        {
+          // ----- Enter critical section -------------------------------------
+          interrupts::critical_section ics;
+
+          if (waiter_ != nullptr)
+            {
+              return EPERM;
+            }
+          waiter_ = &crt_thread;
+          // ----- Exit critical section --------------------------------------
+        }
+
+      internal::clock_timestamps_list& clock_list = sysclock.steady_list ();
+      clock::timestamp_t timeout_timestamp = sysclock.steady_now () + timeout;
+
+      // Prepare a timeout node pointing to the current thread.
+      internal::timeout_thread_node timeout_node
+        { timeout_timestamp, crt_thread };
+
+      for (;;)
+        {
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              if (internal_ready_ (index))
+                {
+                  waiter_ = nullptr;
+#if defined(OS_TRACE_RTOS_WAITSET)
+                  trace::printf (
+                      "%s(%u) @%p %s >%u\n", __func__,
+                      static_cast<unsigned int> (timeout), this, name (),
+                      static_cast<unsigned int> (index != nullptr ? *index : 0));
+#endif
+                  return result::ok;
+                }
+
+              // Remove this thread from the ready list, if there.
+              port::this_thread::prepare_suspend ();
+
+              // Add this thread to the waiting lists of all objects.
+              internal_link_ (crt_thread);
+
+              crt_thread.state_ = thread::state::suspended;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+              evtrace::record_event (evtrace::event::wait_begin, this);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+
+              // Add this thread to the clock timeout list.
+              clock_list.link (timeout_node);
+              timeout_node.thread.clock_node_ = &timeout_node;
+              // ----- Exit critical section ----------------------------------
+            }
+
+          port::scheduler::reschedule ();
+
+            {
+              // ----- Enter critical section ---------------------------------
+              interrupts::critical_section ics;
+
+              // Remove the thread from the clock timeout list,
+              // if not already removed by the timer.
+              timeout_node.thread.clock_node_ = nullptr;
+              timeout_node.unlink ();
+
+              // Remove the thread from all waiting lists,
+              // except the one which resumed it.
+              internal_unlink_ ();
+              crt_thread.waiting_set_ = nullptr;
+
+#if defined(OS_INCLUDE_RTOS_EVTRACE)
+              evtrace::record_event (evtrace::event::wait_end, 0u);
+#endif /* defined(OS_INCLUDE_RTOS_EVTRACE) */
+              // ----- Exit critical section ----------------------------------
+            }
+
+          if (crt_thread.interrupted ())
+            {
+              waiter_ = nullptr;
+#if defined(OS_TRACE_RTOS_WAITSET)
+              trace::printf ("%s(%u) EINTR @%p %s\n", __func__,
+                             static_cast<unsigned int> (timeout), this,
+                             name ());
+#endif
+              return EINTR;
+            }
+
+          if (sysclock.steady_now () >= timeout_timestamp)
+            {
+                {
+                  // ----- Enter critical section -----------------------------
+                  interrupts::critical_section ics;
+
+                  // A last check, the object may be ready right now.
+                  if (internal_ready_ (index))
+                    {
+                      waiter_ = nullptr;
+                      return result::ok;
+                    }
+                  // ----- Exit critical section ------------------------------
+                }
+
+              waiter_ = nullptr;
+#if defined(OS_TRACE_RTOS_WAITSET)
+              trace::printf ("%s(%u) ETIMEDOUT @%p %s\n", __func__,
+                             static_cast<unsigned int> (timeout), this,
+                             name ());
+#endif
+              return ETIMEDOUT;
+            }
+        }
+
+      /* NOTREACHED */
+      return ENOTRECOVERABLE;
+    }
+
+  // --------------------------------------------------------------------------
+
+  } /* namespace rtos */
+} /* namespace os */
+
+// ----------------------------------------------------------------------------
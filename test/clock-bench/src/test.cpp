@@ -0,0 +1,97 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+using namespace os;
+using namespace os::rtos;
+
+// Calls per round and number of rounds; the best round is kept,
+// to filter out the rounds interrupted by the SysTick.
+constexpr uint32_t calls = 1000;
+constexpr uint32_t rounds = 20;
+
+clock::timestamp_t volatile sink;
+
+template<typename F_T>
+  static uint32_t
+  measure (F_T func)
+  {
+    clock::duration_t best = static_cast<clock::duration_t> (-1);
+    for (uint32_t r = 0; r < rounds; ++r)
+      {
+        clock::timestamp_t begin = hrclock.now ();
+        for (uint32_t i = 0; i < calls; ++i)
+          {
+            sink = func ();
+          }
+        clock::duration_t d = static_cast<clock::duration_t> (hrclock.now ()
+            - begin);
+        if (d < best)
+          {
+            best = d;
+          }
+      }
+    return best;
+  }
+
+static void
+report (const char* name, uint32_t cycles, uint32_t overhead)
+{
+  uint32_t net = (cycles > overhead) ? (cycles - overhead) : 0;
+  // Print hundredths of cycle per call.
+  uint32_t h = static_cast<uint32_t> ((static_cast<uint64_t> (net) * 100)
+      / calls);
+  printf ("%-20s %4lu.%02lu cy/call\n", name, h / 100, h % 100);
+}
+
+int
+run_tests ()
+{
+  // The loop itself, with the same store.
+  uint32_t overhead = measure ([]
+    { return static_cast<clock::timestamp_t>(0);});
+
+  report ("sysclock.now()", measure ([]
+    { return sysclock.now ();}),
+          overhead);
+  report ("sysclock.steady_now()", measure ([]
+    { return sysclock.steady_now ();}),
+          overhead);
+  report ("rtclock.now()", measure ([]
+    { return rtclock.now ();}),
+          overhead);
+  report ("hrclock.now()", measure ([]
+    { return hrclock.now ();}),
+          overhead);
+
+  puts ("Done.");
+  return 0;
+}
@@ -0,0 +1,318 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+#include <cassert>
+
+using namespace os;
+using namespace os::rtos;
+
+// The nodes are linked in a standalone clock list and the checks are
+// performed with simulated time stamps, so large steps and steps back
+// in time take no real time. The order of the actions is compared
+// with the order defined for the ordered list: ascending time stamps,
+// and, for equal time stamps, the order in which the nodes were linked.
+
+constexpr std::size_t max_nodes = 64;
+
+class test_node : public internal::timestamp_node
+{
+public:
+
+  test_node () :
+      timestamp_node
+        { 0 }
+  {
+    ;
+  }
+
+  virtual void
+  action (void) override;
+
+  uint32_t seq = 0;
+  bool linked = false;
+};
+
+static test_node nodes[max_nodes];
+static internal::clock_timestamps_list list;
+
+// The actions performed by the latest check.
+static std::size_t performed[max_nodes];
+static std::size_t performed_count;
+
+static uint32_t link_seq;
+static uint32_t checks;
+
+void
+test_node::action (void)
+{
+  unlink ();
+  linked = false;
+  performed[performed_count++] = static_cast<std::size_t> (this - nodes);
+}
+
+static void
+link (std::size_t ix, clock::timestamp_t ts)
+{
+  test_node& node = nodes[ix];
+  assert (!node.linked);
+
+  node.timestamp = ts;
+  node.seq = ++link_seq;
+  node.linked = true;
+
+  interrupts::critical_section ics;
+  list.link (node);
+}
+
+// Return true if a should be performed before b.
+static bool
+before (const test_node& a, const test_node& b)
+{
+  if (a.timestamp != b.timestamp)
+    {
+      return a.timestamp < b.timestamp;
+    }
+  return a.seq < b.seq;
+}
+
+static void
+check (clock::timestamp_t now)
+{
+  // The expected actions, in order.
+  std::size_t expected[max_nodes];
+  std::size_t expected_count = 0;
+  for (std::size_t i = 0; i < max_nodes; ++i)
+    {
+      if (nodes[i].linked && nodes[i].timestamp <= now)
+        {
+          std::size_t j = expected_count++;
+          for (; j > 0 && before (nodes[i], nodes[expected[j - 1]]); --j)
+            {
+              expected[j] = expected[j - 1];
+            }
+          expected[j] = i;
+        }
+    }
+
+  performed_count = 0;
+  list.check_timestamp (now);
+  ++checks;
+
+  if (performed_count != expected_count)
+    {
+      printf ("check %u at %llu: %u actions, %u expected\n",
+              static_cast<unsigned> (checks),
+              static_cast<unsigned long long> (now),
+              static_cast<unsigned> (performed_count),
+              static_cast<unsigned> (expected_count));
+    }
+  assert (performed_count == expected_count);
+  for (std::size_t i = 0; i < expected_count; ++i)
+    {
+      if (performed[i] != expected[i])
+        {
+          printf ("check %u at %llu: action %u is node %u, %u expected\n",
+                  static_cast<unsigned> (checks),
+                  static_cast<unsigned long long> (now),
+                  static_cast<unsigned> (i),
+                  static_cast<unsigned> (performed[i]),
+                  static_cast<unsigned> (expected[i]));
+        }
+      assert (performed[i] == expected[i]);
+    }
+
+    {
+      interrupts::critical_section ics;
+      volatile internal::timestamp_node* head = list.head ();
+      // The earliest node still linked.
+      const test_node* earliest = nullptr;
+      for (std::size_t i = 0; i < max_nodes; ++i)
+        {
+          if (nodes[i].linked
+              && (earliest == nullptr || before (nodes[i], *earliest)))
+            {
+              earliest = &nodes[i];
+            }
+        }
+      if (earliest != nullptr)
+        {
+          assert (head == earliest);
+        }
+    }
+}
+
+static void
+equal_time_stamps (void)
+{
+  // The same time stamp, linked from different distances,
+  // so on different wheel levels.
+  link (0, 5000);
+  check (4000);
+  link (1, 5000);
+  check (4990);
+  link (2, 5000);
+  link (3, 4995);
+  link (4, 5000);
+  check (5000);
+
+  // Overdue when linked, after future nodes with the same time stamp.
+  link (5, 6000);
+  link (6, 6000);
+  check (6000);
+  link (7, 6000);
+  link (8, 5999);
+  check (6001);
+
+  // More nodes than in a single slot, all equal.
+  for (std::size_t i = 0; i < 16; ++i)
+    {
+      link (i, 300000);
+    }
+  check (299999);
+  check (300000);
+
+  printf ("equal time stamps passed\n");
+}
+
+static void
+overflow_relink (void)
+{
+  // Beyond the wheel range (64^4 ticks), relinked when the
+  // base gets closer.
+  constexpr clock::timestamp_t far = static_cast<clock::timestamp_t> (1)
+      << 24;
+  clock::timestamp_t base = 400000;
+  check (base);
+
+  link (0, base + far + 100);
+  link (1, base + 300);
+  link (2, base + far + 100);
+  link (3, base + 2 * far + 7);
+  link (4, base + far + 99);
+
+  check (base + far / 2);
+  check (base + far);
+  link (5, base + far + 100);
+  check (base + far + 99);
+  check (base + far + 100);
+  check (base + 2 * far);
+  check (base + 2 * far + 7);
+
+  printf ("overflow relink passed\n");
+}
+
+static void
+rebase (void)
+{
+  // An adjustable clock going back in time.
+  clock::timestamp_t base = 100000000;
+  check (base);
+
+  link (0, base + 100);
+  link (1, base + 200);
+  link (2, base + 200);
+  link (3, base + 70000);
+  check (base + 50);
+
+  check (base - 1000);
+  link (4, base - 900);
+  link (5, base + 200);
+  check (base - 900);
+  check (base + 200);
+
+  // Back again, beyond the wheel range.
+  check (base - 50000000);
+  link (6, base - 49999999);
+  check (base + 70000);
+
+  printf ("rebase passed\n");
+}
+
+static void
+random_steps (void)
+{
+  // Deterministic pseudo-random steps, covering all wheel levels,
+  // the overflow list and occasional steps back.
+  uint32_t r = 12345;
+  auto next = [&r] (void) -> uint32_t
+    {
+      r = r * 1103515245u + 12345u;
+      return r >> 8;
+    };
+
+  clock::timestamp_t now = 200000000;
+  check (now);
+  for (std::size_t step = 0; step < 2000; ++step)
+    {
+      for (std::size_t k = next () % 4; k > 0; --k)
+        {
+          std::size_t ix = next () % max_nodes;
+          if (!nodes[ix].linked)
+            {
+              uint32_t shift = next () % 26;
+              link (ix, now + (next () & ((1u << shift) - 1)));
+            }
+        }
+
+      uint32_t shift = next () % 26;
+      clock::timestamp_t delta = next () & ((1u << shift) - 1);
+      if (next () % 64 == 0)
+        {
+          now -= delta;
+        }
+      else
+        {
+          now += delta;
+        }
+      check (now);
+    }
+
+  // Drain all.
+  check (now + (static_cast<clock::timestamp_t> (1) << 40));
+
+  printf ("random steps passed\n");
+}
+
+int
+run_tests ()
+{
+  equal_time_stamps ();
+  overflow_relink ();
+  rebase ();
+  random_steps ();
+
+  printf ("%u checks\n", static_cast<unsigned> (checks));
+
+  puts ("Done.");
+  return 0;
+}
@@ -0,0 +1,179 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+using namespace os;
+using namespace os::rtos;
+
+// The clock interrupt is used as the probe: a periodic timer
+// function runs in the SysTick handler and reads the cycles
+// elapsed since the tick; any time spent with interrupts disabled
+// when the tick occurs delays the handler and adds to this value.
+
+// Ticks to sample for each message size.
+constexpr uint32_t duration_ticks = 500;
+
+// Messages in each queue.
+constexpr std::size_t depth = 4;
+
+// Message sizes to measure, in bytes.
+constexpr std::size_t sizes[] =
+  { 4, 16, 64, 128, 256, 512, 1024, 2048 };
+
+constexpr std::size_t max_msg_size = 2048;
+
+static char msg_out[max_msg_size];
+static char msg_in[max_msg_size];
+
+static uint32_t volatile worst;
+static uint32_t volatile ticks;
+
+static void
+probe (void* args __attribute__((unused)))
+{
+  uint32_t cycles = port::clock_highres::cycles_since_tick ();
+  if (cycles > worst)
+    {
+      worst = cycles;
+    }
+  ++ticks;
+}
+
+static void
+report (const char* name, std::size_t size, uint32_t cycles,
+        uint32_t baseline)
+{
+  uint32_t masked = (cycles > baseline) ? (cycles - baseline) : 0;
+  // Print hundredths of microsecond.
+  uint32_t h = static_cast<uint32_t> ((static_cast<uint64_t> (masked)
+      * 100000000ull) / hrclock.input_clock_frequency_hz ());
+  printf ("%-14s %5u bytes %7lu cy %4lu.%02lu us\n", name,
+          static_cast<unsigned> (size), static_cast<unsigned long> (masked),
+          static_cast<unsigned long> (h / 100),
+          static_cast<unsigned long> (h % 100));
+}
+
+// Run the function until the given number of ticks is sampled
+// and return the worst delay of the clock interrupt.
+template<typename F_T>
+  static uint32_t
+  sample (F_T func)
+  {
+    worst = 0;
+    uint32_t end = ticks + duration_ticks;
+    while (ticks < end)
+      {
+        func ();
+      }
+    return worst;
+  }
+
+static message_queue* volatile consumer_queue;
+
+static void*
+consumer (void* args __attribute__((unused)))
+{
+  message_queue* mq = consumer_queue;
+  std::size_t size = mq->msg_size ();
+  for (;;)
+    {
+      mq->receive (msg_in, size);
+      if (msg_in[0] != 0)
+        {
+          // End marker.
+          break;
+        }
+    }
+  return nullptr;
+}
+
+int
+run_tests ()
+{
+  timer probe_timer
+    { "probe", probe, nullptr, timer::periodic_initializer };
+  probe_timer.start (1);
+
+  // The delay of the handler itself, with no queue activity.
+  uint32_t baseline = sample ([]
+    {});
+  printf ("baseline %lu cy\n\n", static_cast<unsigned long> (baseline));
+
+  for (std::size_t size : sizes)
+    {
+      message_queue mq
+        { "mq", depth, size };
+
+      // Fill the queue, then drain it; all copies go through
+      // the queue storage.
+      report ("queue", size, sample ([&mq, size]
+        {
+          for (std::size_t i = 0; i < depth; ++i)
+            {
+              mq.try_send (msg_out, size);
+            }
+          for (std::size_t i = 0; i < depth; ++i)
+            {
+              mq.try_receive (msg_in, size);
+            }
+        }),
+              baseline);
+
+      // Send to a higher priority thread waiting to receive; small
+      // messages are copied directly to the receiver buffer.
+      consumer_queue = &mq;
+      thread::attributes attr;
+      attr.th_priority = thread::priority::above_normal;
+      thread th
+        { "consumer", consumer, nullptr, attr };
+
+      report ("waiting thread", size, sample ([&mq, size]
+        {
+          mq.send (msg_out, size);
+        }),
+              baseline);
+
+      msg_out[0] = 1;
+      mq.send (msg_out, size);
+      msg_out[0] = 0;
+      th.join ();
+    }
+
+  probe_timer.stop ();
+
+  printf (
+      "\nDirect transfers up to %u bytes.\n",
+      static_cast<unsigned> (OS_INTEGER_RTOS_MESSAGE_QUEUE_HANDOFF_MAX_SIZE_BYTES));
+
+  puts ("Done.");
+  return 0;
+}
@@ -0,0 +1,287 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+#include <cassert>
+
+using namespace os;
+using namespace os::rtos;
+
+// The messages are sent and received with the non-blocking calls,
+// and the order in which they are received is compared with the
+// order defined for message queues: descending priorities, and,
+// for equal priorities, the order in which they were sent (FIFO).
+// The output must be the same with and without the priority bitmap.
+
+constexpr std::size_t max_msgs = 64;
+
+typedef struct msg_s
+{
+  uint32_t seq;
+  uint32_t prio;
+} msg_t;
+
+using queue_t = message_queue_inclusive<msg_t, max_msgs>;
+
+static queue_t* queue;
+
+// The reference model, the messages in the queue.
+static msg_t model_msgs[max_msgs];
+static message_queue::priority_t model_prios[max_msgs];
+static std::size_t model_count;
+
+static uint32_t send_seq;
+static uint32_t receives;
+
+static void
+send (message_queue::priority_t mprio)
+{
+  assert (model_count < max_msgs);
+
+  msg_t msg
+    { ++send_seq, mprio };
+
+  // Alternate between send() and the zero-copy commit(),
+  // which share the priority insertion.
+  if (send_seq % 3 == 0)
+    {
+      void* slot;
+      result_t res = queue->try_loan (&slot);
+      assert (res == result::ok);
+      *static_cast<msg_t*> (slot) = msg;
+      res = queue->commit (slot, mprio);
+      assert (res == result::ok);
+    }
+  else
+    {
+      result_t res = queue->try_send (&msg, mprio);
+      assert (res == result::ok);
+    }
+
+  model_msgs[model_count] = msg;
+  model_prios[model_count] = mprio;
+  ++model_count;
+}
+
+static void
+receive (void)
+{
+  assert (model_count > 0);
+
+  // The expected message: the highest priority, and the first one
+  // sent with it.
+  std::size_t expected = 0;
+  for (std::size_t i = 1; i < model_count; ++i)
+    {
+      if (model_prios[i] > model_prios[expected])
+        {
+          expected = i;
+        }
+    }
+
+  msg_t msg;
+  message_queue::priority_t mprio;
+  result_t res = queue->try_receive (&msg, &mprio);
+  ++receives;
+  assert (res == result::ok);
+
+  if (msg.seq != model_msgs[expected].seq
+      || mprio != model_prios[expected])
+    {
+      printf ("receive %u: message %u prio %u, %u prio %u expected\n",
+              static_cast<unsigned> (receives),
+              static_cast<unsigned> (msg.seq), static_cast<unsigned> (mprio),
+              static_cast<unsigned> (model_msgs[expected].seq),
+              static_cast<unsigned> (model_prios[expected]));
+    }
+  assert (msg.seq == model_msgs[expected].seq);
+  assert (mprio == model_prios[expected]);
+  assert (msg.prio == mprio);
+
+  // Keep the model in the send order.
+  --model_count;
+  for (std::size_t i = expected; i < model_count; ++i)
+    {
+      model_msgs[i] = model_msgs[i + 1];
+      model_prios[i] = model_prios[i + 1];
+    }
+  assert (queue->length () == model_count);
+}
+
+static void
+drain (void)
+{
+  while (model_count > 0)
+    {
+      receive ();
+    }
+
+  msg_t msg;
+  assert (queue->try_receive (&msg) == EWOULDBLOCK);
+}
+
+static void
+word_boundaries (void)
+{
+  // The priorities around the 32-bit words of the bitmap, sent
+  // from the lowest to the highest, from the highest to the
+  // lowest, and interleaved, twice each for FIFO.
+  static const message_queue::priority_t prios[] =
+    { 0, 1, 31, 32, 33, 63, 64, 95, 96, 127, 128, 159, 160, 191, 192, 223,
+        224, 254, 255 };
+  constexpr std::size_t n = sizeof(prios) / sizeof(prios[0]);
+
+  for (std::size_t i = 0; i < n; ++i)
+    {
+      send (prios[i]);
+      send (prios[i]);
+    }
+  drain ();
+
+  for (std::size_t i = n; i > 0; --i)
+    {
+      send (prios[i - 1]);
+      send (prios[i - 1]);
+    }
+  drain ();
+
+  for (std::size_t k = 0; k < 2; ++k)
+    {
+      for (std::size_t i = 0; i < n; i += 2)
+        {
+          send (prios[i]);
+        }
+      for (std::size_t i = 1; i < n; i += 2)
+        {
+          send (prios[i]);
+        }
+    }
+  drain ();
+
+  printf ("word boundaries passed\n");
+}
+
+static void
+fifo_within_priority (void)
+{
+  // Equal priorities, on both sides of a word boundary,
+  // with receives in between, so new messages are linked
+  // after the remaining ones.
+  for (std::size_t i = 0; i < 8; ++i)
+    {
+      send (31);
+      send (32);
+      send (255);
+    }
+  for (std::size_t i = 0; i < 10; ++i)
+    {
+      receive ();
+    }
+  for (std::size_t i = 0; i < 8; ++i)
+    {
+      send (32);
+      send (31);
+      send (0);
+    }
+  drain ();
+
+  // A single priority, filling the queue.
+  for (std::size_t i = 0; i < max_msgs; ++i)
+    {
+      send (32);
+    }
+  msg_t msg
+    { 0, 32 };
+  assert (queue->try_send (&msg, 32) == EWOULDBLOCK);
+  drain ();
+
+  printf ("fifo within priority passed\n");
+}
+
+static void
+random_steps (void)
+{
+  // Deterministic pseudo-random sends and receives, with
+  // priorities mostly near the word boundaries.
+  uint32_t r = 12345;
+  auto next = [&r] (void) -> uint32_t
+    {
+      r = r * 1103515245u + 12345u;
+      return r >> 8;
+    };
+
+  for (std::size_t step = 0; step < 20000; ++step)
+    {
+      bool do_send = (model_count == 0)
+          || (model_count < max_msgs && next () % 2 == 0);
+      if (do_send)
+        {
+          message_queue::priority_t mprio;
+          if (next () % 4 == 0)
+            {
+              mprio = static_cast<message_queue::priority_t> (next ());
+            }
+          else
+            {
+              // A word boundary, or one of its neighbours.
+              uint32_t word = next () % 8;
+              int offset = static_cast<int> (next () % 3) - 1;
+              mprio = static_cast<message_queue::priority_t> (word * 32
+                  + static_cast<uint32_t> (offset));
+            }
+          send (mprio);
+        }
+      else
+        {
+          receive ();
+        }
+    }
+  drain ();
+
+  printf ("random steps passed\n");
+}
+
+int
+run_tests ()
+{
+  static queue_t q
+    { "q" };
+  queue = &q;
+
+  word_boundaries ();
+  fifo_within_priority ();
+  random_steps ();
+
+  printf ("%u messages\n", static_cast<unsigned> (receives));
+
+  puts ("Done.");
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+using namespace os;
+using namespace os::rtos;
+
+// Pairs per round and number of rounds; the best round is kept,
+// to filter out the rounds interrupted by the SysTick.
+constexpr uint32_t pairs = 1000;
+constexpr uint32_t rounds = 20;
+
+result_t volatile sink;
+
+template<typename F_T>
+  static uint32_t
+  measure (F_T func)
+  {
+    clock::duration_t best = static_cast<clock::duration_t> (-1);
+    for (uint32_t r = 0; r < rounds; ++r)
+      {
+        clock::timestamp_t begin = hrclock.now ();
+        for (uint32_t i = 0; i < pairs; ++i)
+          {
+            sink = func ();
+          }
+        clock::duration_t d = static_cast<clock::duration_t> (hrclock.now ()
+            - begin);
+        if (d < best)
+          {
+            best = d;
+          }
+      }
+    return best;
+  }
+
+static void
+report (const char* name, uint32_t cycles, uint32_t overhead)
+{
+  uint32_t net = (cycles > overhead) ? (cycles - overhead) : 0;
+  // Print hundredths of cycle per pair.
+  uint32_t h = static_cast<uint32_t> ((static_cast<uint64_t> (net) * 100)
+      / pairs);
+  printf ("%-24s %5lu.%02lu cy/pair\n", name,
+          static_cast<unsigned long> (h / 100),
+          static_cast<unsigned long> (h % 100));
+}
+
+mutex mx_normal
+  { "normal", mutex::initializer_normal };
+
+mutex mx_recursive
+  { "recursive", mutex::initializer_recursive };
+
+static mutex::attributes
+make_errorcheck (void)
+{
+  mutex::attributes attr;
+  attr.mx_type = mutex::type::errorcheck;
+  return attr;
+}
+
+static mutex::attributes
+make_none (void)
+{
+  mutex::attributes attr;
+  attr.mx_protocol = mutex::protocol::none;
+  return attr;
+}
+
+static mutex::attributes
+make_robust (void)
+{
+  mutex::attributes attr;
+  attr.mx_robustness = mutex::robustness::robust;
+  return attr;
+}
+
+int
+run_tests ()
+{
+  mutex mx_ec
+    { "errorcheck", make_errorcheck () };
+  mutex mx_pn
+    { "none", make_none () };
+  mutex mx_rb
+    { "robust", make_robust () };
+
+  // The loop itself, with the same store.
+  uint32_t overhead = measure ([]
+    { return static_cast<result_t>(0);});
+
+  // Uncontended pairs; with the fast path, the first three
+  // do not enter critical sections.
+  report ("normal lock/unlock", measure ([]
+    {
+      mx_normal.lock ();
+      return mx_normal.unlock ();
+    }),
+          overhead);
+  report ("errorcheck lock/unlock", measure ([&mx_ec]
+    {
+      mx_ec.lock ();
+      return mx_ec.unlock ();
+    }),
+          overhead);
+  report ("protocol::none", measure ([&mx_pn]
+    {
+      mx_pn.lock ();
+      return mx_pn.unlock ();
+    }),
+          overhead);
+  report ("normal try_lock/unlock", measure ([]
+    {
+      mx_normal.try_lock ();
+      return mx_normal.unlock ();
+    }),
+          overhead);
+
+  // Always on the slow path, for reference.
+  report ("recursive lock/unlock", measure ([]
+    {
+      mx_recursive.lock ();
+      return mx_recursive.unlock ();
+    }),
+          overhead);
+  report ("robust lock/unlock", measure ([&mx_rb]
+    {
+      mx_rb.lock ();
+      return mx_rb.unlock ();
+    }),
+          overhead);
+
+  puts ("Done.");
+  return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+using namespace os;
+using namespace os::rtos;
+
+// Operations per round and number of rounds; the best round is kept,
+// to filter out the rounds interrupted by the SysTick.
+constexpr uint32_t ops = 1000;
+constexpr uint32_t rounds = 20;
+
+// Elements per burst, the capacity of both queues.
+constexpr std::size_t depth = 16;
+
+// Elements passed to the consumer thread in the hand-off tests.
+constexpr uint32_t handoffs = 10000;
+
+result_t volatile sink;
+
+template<typename F_T>
+  static uint32_t
+  measure (F_T func)
+  {
+    clock::duration_t best = static_cast<clock::duration_t> (-1);
+    for (uint32_t r = 0; r < rounds; ++r)
+      {
+        clock::timestamp_t begin = hrclock.now ();
+        for (uint32_t i = 0; i < ops; ++i)
+          {
+            sink = func ();
+          }
+        clock::duration_t d = static_cast<clock::duration_t> (hrclock.now ()
+            - begin);
+        if (d < best)
+          {
+            best = d;
+          }
+      }
+    return best;
+  }
+
+static void
+report (const char* name, uint32_t cycles, uint32_t overhead, uint32_t count)
+{
+  uint32_t net = (cycles > overhead) ? (cycles - overhead) : 0;
+  // Print hundredths of cycle per element.
+  uint32_t h = static_cast<uint32_t> ((static_cast<uint64_t> (net) * 100)
+      / count);
+  printf ("%-28s %5lu.%02lu cy/elem\n", name,
+          static_cast<unsigned long> (h / 100),
+          static_cast<unsigned long> (h % 100));
+}
+
+spsc_queue<uint32_t, depth> sq
+  { "sq" };
+
+message_queue_inclusive<uint32_t, depth> mq
+  { "mq" };
+
+static void*
+spsc_consumer (void* args __attribute__((unused)))
+{
+  uint32_t v;
+  for (uint32_t i = 0; i < handoffs; ++i)
+    {
+      sq.pop (v);
+    }
+  return nullptr;
+}
+
+static void*
+mq_consumer (void* args __attribute__((unused)))
+{
+  uint32_t v;
+  for (uint32_t i = 0; i < handoffs; ++i)
+    {
+      mq.receive (&v);
+    }
+  return nullptr;
+}
+
+// The producer runs on the main thread, in place of an interrupt
+// handler, and yields when the queue is full.
+template<typename F_T>
+  static uint32_t
+  handoff (thread::func_t consumer, F_T push)
+  {
+    thread th
+      { "consumer", consumer, nullptr };
+
+    clock::timestamp_t begin = hrclock.now ();
+    for (uint32_t i = 0; i < handoffs;)
+      {
+        if (push (i) == result::ok)
+          {
+            ++i;
+          }
+        else
+          {
+            this_thread::yield ();
+          }
+      }
+    th.join ();
+    return static_cast<uint32_t> (hrclock.now () - begin);
+  }
+
+int
+run_tests ()
+{
+  // The loop itself, with the same store.
+  uint32_t overhead = measure ([]
+    { return static_cast<result_t>(0);});
+
+  // One element in, one element out; the queue never has more
+  // than one element.
+  report ("spsc push/try_pop", measure ([]
+    {
+      uint32_t v = 0;
+      sq.push (v);
+      return sq.try_pop (v);
+    }),
+          overhead, ops);
+  report ("mqueue try_send/try_receive", measure ([]
+    {
+      uint32_t v = 0;
+      mq.try_send (&v);
+      return mq.try_receive (&v);
+    }),
+          overhead, ops);
+
+  // Fill the queue, then drain it, as after a burst of interrupts.
+  report ("spsc burst", measure ([]
+    {
+      uint32_t v = 0;
+      for (std::size_t i = 0; i < depth; ++i)
+        {
+          sq.push (v);
+        }
+      result_t res = result::ok;
+      for (std::size_t i = 0; i < depth; ++i)
+        {
+          res = sq.try_pop (v);
+        }
+      return res;
+    }),
+          overhead, ops * depth);
+  report ("mqueue burst", measure ([]
+    {
+      uint32_t v = 0;
+      for (std::size_t i = 0; i < depth; ++i)
+        {
+          mq.try_send (&v);
+        }
+      result_t res = result::ok;
+      for (std::size_t i = 0; i < depth; ++i)
+        {
+          res = mq.try_receive (&v);
+        }
+      return res;
+    }),
+          overhead, ops * depth);
+
+  // Pass elements to a thread waiting on the queue.
+  report ("spsc hand-off", handoff (spsc_consumer, [] (uint32_t v)
+    { return sq.push (v);}),
+          0, handoffs);
+  report ("mqueue hand-off", handoff (mq_consumer, [] (uint32_t v)
+    { return mq.try_send (&v);}),
+          0, handoffs);
+
+  puts ("Done.");
+  return 0;
+}
@@ -516,6 +516,13 @@ test_c_api (void)
       os_semaphore_t sp3;
       os_semaphore_counting_construct (&sp3, "sp3", 7, 7);
 
+      // Take and release several resources at once.
+      os_semaphore_wait_n (&sp3, 3);
+      os_semaphore_try_wait_n (&sp3, 2);
+      os_semaphore_post_n (&sp3, 5);
+      os_semaphore_timed_wait_n (&sp3, 4, 1);
+      os_semaphore_post_n (&sp3, 4);
+
       os_semaphore_destruct (&sp3);
     }
 
@@ -633,6 +640,42 @@ test_c_api (void)
       os_mqueue_timed_receive (&q1, &msg_in, sizeof(msg_in), 1, NULL);
       assert(msg_in.i = 1);
 
+      void* slot;
+
+      os_mqueue_loan (&q1, &slot);
+      *(my_msg_t*) slot = msg_out;
+      os_mqueue_commit (&q1, slot, 0);
+      os_mqueue_acquire (&q1, &slot, NULL);
+      msg_in = *(my_msg_t*) slot;
+      os_mqueue_release (&q1, slot);
+
+      os_mqueue_try_loan (&q1, &slot);
+      os_mqueue_commit (&q1, slot, 0);
+      os_mqueue_try_acquire (&q1, &slot, NULL);
+      os_mqueue_release (&q1, slot);
+
+      os_mqueue_timed_loan (&q1, &slot, 1);
+      os_mqueue_commit (&q1, slot, 0);
+      os_mqueue_timed_acquire (&q1, &slot, 1, NULL);
+      os_mqueue_release (&q1, slot);
+
+      my_msg_t msgs[3] =
+        {
+          { 1, "msg1" },
+          { 2, "msg2" },
+          { 3, "msg3" } };
+      size_t cnt;
+
+      os_mqueue_send_many (&q1, msgs, 3, &cnt, 0);
+      os_mqueue_receive_many (&q1, msgs, 3, &cnt, NULL);
+      assert(cnt == 3);
+
+      os_mqueue_try_send_many (&q1, msgs, 3, &cnt, 0);
+      os_mqueue_try_receive_many (&q1, msgs, 3, &cnt, NULL);
+
+      os_mqueue_timed_send_many (&q1, msgs, 3, NULL, 1, 0);
+      os_mqueue_timed_receive_many (&q1, msgs, 3, &cnt, 1, NULL);
+
 #pragma GCC diagnostic push
 
 #if defined(__clang__)
@@ -689,6 +732,34 @@ test_c_api (void)
       os_mqueue_destruct (&q2);
     }
 
+    {
+      // Lock free queue, static storage; long double for alignment.
+      static long double cells[64];
+      assert(os_mpmc_queue_compute_storage_size (4, sizeof(my_msg_t)) <= sizeof(cells));
+
+      os_mpmc_queue_t lfq;
+      os_mpmc_queue_construct (&lfq, "lfq", 4, sizeof(my_msg_t), cells,
+                               sizeof(cells));
+
+      os_mpmc_queue_try_push (&lfq, &msg_out);
+      os_mpmc_queue_push (&lfq, &msg_out);
+      os_mpmc_queue_timed_push (&lfq, &msg_out, 1);
+
+      msg_in.i = 0;
+      os_mpmc_queue_try_pop (&lfq, &msg_in);
+      assert(msg_in.i == 1);
+      os_mpmc_queue_pop (&lfq, &msg_in);
+      os_mpmc_queue_timed_pop (&lfq, &msg_in, 1);
+
+      name = os_mpmc_queue_get_name (&lfq);
+      os_mpmc_queue_get_length (&lfq);
+      os_mpmc_queue_get_capacity (&lfq);
+      os_mpmc_queue_is_empty (&lfq);
+      os_mpmc_queue_is_full (&lfq);
+
+      os_mpmc_queue_destruct (&lfq);
+    }
+
     {
       // Simple queues, dynamically allocated.
       os_mqueue_t* q3;
@@ -787,6 +858,45 @@ test_c_api (void)
 
   // ==========================================================================
 
+  printf ("\n%s - Read-write locks.\n", test_name);
+
+    {
+      os_rwlock_t rw1;
+      os_rwlock_construct (&rw1, "rw1", NULL);
+
+      os_rwlock_read_lock (&rw1);
+      os_rwlock_try_read_lock (&rw1);
+      os_rwlock_unlock (&rw1);
+      os_rwlock_unlock (&rw1);
+
+      os_rwlock_write_lock (&rw1);
+      os_rwlock_unlock (&rw1);
+
+      os_rwlock_timed_write_lock (&rw1, 1);
+      os_rwlock_unlock (&rw1);
+
+      name = os_rwlock_get_name (&rw1);
+
+      os_rwlock_destruct (&rw1);
+    }
+
+    {
+      os_rwlock_attr_t attr;
+      os_rwlock_attr_init (&attr);
+      attr.rw_max_readers = 2;
+
+      os_rwlock_t* rw2;
+      rw2 = os_rwlock_new ("rw2", &attr);
+
+      os_rwlock_timed_read_lock (rw2, 1);
+      os_rwlock_try_write_lock (rw2);
+      os_rwlock_unlock (rw2);
+
+      os_rwlock_delete (rw2);
+    }
+
+  // ==========================================================================
+
   printf ("\n%s - Done.\n", test_name);
   return 0;
 }
@@ -23,6 +23,7 @@
 #include <cmsis-plus/estd/mutex>
 
 #include <algorithm>
+#include <cassert>
 
 #include <test-cpp-api.h>
 
@@ -48,6 +49,30 @@ typedef struct my_blk_s
   const char* s;
 } my_blk_t;
 
+typedef struct my_cv_wait_s
+{
+  mutex* mx;
+  condition_variable* cv;
+  clock::duration_t timeout;
+  result_t res;
+} my_cv_wait_t;
+
+typedef struct my_rw_wait_s
+{
+  rwlock* rw;
+  clock::duration_t timeout;
+  result_t res;
+} my_rw_wait_t;
+
+typedef struct my_ws_wait_s
+{
+  wait_set* ws;
+  message_queue* mq;
+  memory_pool* mp;
+  void* blk;
+  result_t res;
+} my_ws_wait_t;
+
 #pragma GCC diagnostic pop
 
 void*
@@ -61,6 +86,78 @@ func (void* args __attribute__((unused)))
   return nullptr;
 }
 
+void*
+cvfunc (void* args);
+
+void*
+cvfunc (void* args)
+{
+  my_cv_wait_t* w = static_cast<my_cv_wait_t*> (args);
+
+  w->mx->lock ();
+  w->res = w->cv->timed_wait (*w->mx, w->timeout);
+  w->mx->unlock ();
+
+  return nullptr;
+}
+
+void*
+rwfunc (void* args);
+
+void*
+rwfunc (void* args)
+{
+  my_rw_wait_t* w = static_cast<my_rw_wait_t*> (args);
+
+  w->res = w->rw->timed_read_lock (w->timeout);
+  if (w->res == result::ok)
+    {
+      w->rw->unlock ();
+    }
+
+  return nullptr;
+}
+
+void*
+wsfunc (void* args);
+
+void*
+wsfunc (void* args)
+{
+  my_ws_wait_t* w = static_cast<my_ws_wait_t*> (args);
+
+  w->res = w->ws->wait_any ();
+
+  return nullptr;
+}
+
+void*
+mqrfunc (void* args);
+
+void*
+mqrfunc (void* args)
+{
+  my_ws_wait_t* w = static_cast<my_ws_wait_t*> (args);
+
+  my_msg_t msg;
+  w->res = w->mq->timed_receive (&msg, sizeof(msg), 5);
+
+  return nullptr;
+}
+
+void*
+mpafunc (void* args);
+
+void*
+mpafunc (void* args)
+{
+  my_ws_wait_t* w = static_cast<my_ws_wait_t*> (args);
+
+  w->blk = w->mp->timed_alloc (5);
+
+  return nullptr;
+}
+
 void
 tmfunc (void* args);
 
@@ -484,6 +581,18 @@ test_cpp_api (void)
       tq1.timed_send (&msg_out, 1);
       tq1.timed_receive (&msg_in, 1);
 
+      my_msg_t tq_msgs[4];
+      std::size_t tq_cnt;
+
+      tq1.send_many (tq_msgs, 4, &tq_cnt);
+      tq1.receive_many (tq_msgs, 4, &tq_cnt);
+
+      tq1.try_send_many (tq_msgs, 4, &tq_cnt);
+      tq1.try_receive_many (tq_msgs, 4, &tq_cnt);
+
+      tq1.timed_send_many (tq_msgs, 4, &tq_cnt, 1);
+      tq1.timed_receive_many (tq_msgs, 4, &tq_cnt, 1);
+
       My_queue tq2
         { "tq2", 7 };
 
@@ -567,6 +676,48 @@ test_cpp_api (void)
       sq2.send (&msg_out);
       sq2.receive (&msg_in);
 
+      // Zero-copy usage; the message is built and used in place.
+      void* slot;
+
+      sq1.loan (&slot);
+      *static_cast<my_msg_t*> (slot) = msg_out;
+      sq1.commit (slot);
+      sq1.acquire (&slot);
+      msg_in = *static_cast<my_msg_t*> (slot);
+      sq1.release (slot);
+
+      sq1.try_loan (&slot);
+      sq1.commit (slot, 1);
+      sq1.try_acquire (&slot);
+      sq1.release (slot);
+
+      sq1.timed_loan (&slot, 1);
+      sq1.commit (slot);
+      sq1.timed_acquire (&slot, 1);
+      sq1.release (slot);
+
+      // A reset leaves the loaned and acquired slots to their owners.
+      sq1.try_loan (&slot);
+      sq1.reset ();
+      assert (sq1.commit (slot) == result::ok);
+      sq1.try_acquire (&slot);
+      sq1.reset ();
+      assert (sq1.release (slot) == result::ok);
+      assert (sq1.empty ());
+
+      // Batch usage; up to the array size messages at once.
+      my_msg_t msgs[3];
+      message_queue::priority_t prios[3];
+      std::size_t cnt;
+
+      sq1.send_many (msgs, 3, &cnt);
+      sq1.receive_many (msgs, 3, &cnt, prios);
+
+      sq1.try_send_many (msgs, 3, nullptr, 1);
+      sq1.try_receive_many (msgs, 3, &cnt);
+
+      sq1.timed_send_many (msgs, 3, &cnt, 1);
+      sq1.timed_receive_many (msgs, 3, &cnt, 1);
     }
 
   // ==========================================================================
@@ -810,6 +961,100 @@ test_cpp_api (void)
       cv2->signal ();
     }
 
+    {
+      mutex mx
+        { "cvmx" };
+      condition_variable cv
+        { "cv8" };
+
+      // Not signalled, times out.
+      my_cv_wait_t w1
+        { &mx, &cv, 2, result::ok };
+      thread th1
+        { "cvw1", cvfunc, &w1 };
+      th1.join ();
+      assert (w1.res == ETIMEDOUT);
+
+      // Signalled before the deadline, but the signaller keeps
+      // the mutex past it; the signal must not be reported as
+      // a timeout.
+      my_cv_wait_t w2
+        { &mx, &cv, 3, ETIMEDOUT };
+      thread th2
+        { "cvw2", cvfunc, &w2 };
+      sysclock.sleep_for (1); // Sync
+
+      mx.lock ();
+      cv.signal ();
+      sysclock.sleep_for (6);
+      mx.unlock ();
+
+      th2.join ();
+      assert (w2.res == result::ok);
+    }
+
+  // ==========================================================================
+
+  printf ("\n%s - Read-write locks.\n", test_name);
+    {
+      rwlock rw1;
+      rw1.read_lock ();
+      rw1.try_read_lock ();
+      rw1.unlock ();
+      rw1.unlock ();
+
+      rwlock rw2
+        { "rw2" };
+      rw2.write_lock ();
+      rw2.unlock ();
+
+      rw2.try_write_lock ();
+      rw2.unlock ();
+
+      rw2.timed_read_lock (1);
+      rw2.unlock ();
+      rw2.timed_write_lock (1);
+      rw2.unlock ();
+    }
+
+    {
+      rwlock* rw;
+      rw = new rwlock
+        { "rw3" };
+
+      rw->read_lock ();
+      rw->unlock ();
+
+      // Mandatory delete.
+      delete rw;
+    }
+
+    {
+      // A waiter which times out must not leave its boost
+      // on the writer.
+      rwlock rw4
+        { "rw4" };
+      thread::priority_t prio = this_thread::thread ().priority ();
+
+      rw4.write_lock ();
+
+      thread::attributes attr;
+      attr.th_priority = static_cast<thread::priority_t> (prio + 1);
+
+      my_rw_wait_t w
+        { &rw4, 5, result::ok };
+      thread th1
+        { "rww1", rwfunc, &w, attr };
+      sysclock.sleep_for (1); // Sync
+      assert (this_thread::thread ().priority () > prio);
+
+      th1.join ();
+      assert (w.res == ETIMEDOUT);
+      assert (this_thread::thread ().priority () == prio);
+
+      rw4.unlock ();
+    }
+
   // ==========================================================================
 
   printf ("\n%s - Event flags.\n", test_name);
@@ -1024,6 +1269,18 @@ test_cpp_api (void)
       sp.timed_wait (0xFFFFFFFF);
     }
 
+    {
+      // Named counting semaphore, several resources at once.
+      semaphore_counting sp
+        { "sp4", 7, 7 };
+
+      sp.wait (3);
+      sp.try_wait (2);
+      sp.post (5);
+      sp.timed_wait (4, 1);
+      sp.post (4);
+    }
+
     {
       // Named binary semaphore.
       semaphore sp
@@ -1076,6 +1333,178 @@ test_cpp_api (void)
 
   // ==========================================================================
 
+  printf ("\n%s - Wait sets.\n", test_name);
+
+    {
+      semaphore ws_sem
+        { "ws_sem" };
+      message_queue ws_mq
+        { 3, sizeof(my_msg_t) };
+      memory_pool ws_mp
+        { 3, sizeof(my_blk_t) };
+      event_flags ws_ev;
+
+      wait_set ws1;
+      ws1.add (ws_sem);
+      ws1.add (ws_mq);
+      ws1.add (ws_mp);
+      ws1.add (ws_ev, 0x3, flags::mode::any);
+      ws1.add_thread_flags (0x1);
+
+      wait_set::index_t index;
+
+      // The memory pool has free blocks.
+      ws1.try_wait_any (&index);
+      ws1.wait_any (&index);
+
+      ws_sem.post ();
+      ws1.timed_wait_any (1, &index);
+      ws_sem.try_wait ();
+
+      ws1.clear ();
+
+      wait_set ws2
+        { "ws2" };
+      ws2.add (ws_ev, 0x1);
+      ws2.timed_wait_any (1);
+    }
+
+    {
+      // A set waiting before a blocked receiver must not take
+      // the wake-up meant for the receiver.
+      semaphore ws_sem
+        { "ws_sem2" };
+      message_queue ws_mq
+        { 3, sizeof(my_msg_t) };
+
+      wait_set ws3
+        { "ws3" };
+      ws3.add (ws_mq);
+      ws3.add (ws_sem);
+
+      my_ws_wait_t ws
+        { &ws3, nullptr, nullptr, nullptr, ETIMEDOUT };
+      thread th1
+        { "wsw1", wsfunc, &ws };
+      sysclock.sleep_for (1); // Sync
+
+      my_ws_wait_t rw
+        { nullptr, &ws_mq, nullptr, nullptr, ETIMEDOUT };
+      thread th2
+        { "wsr1", mqrfunc, &rw };
+      sysclock.sleep_for (1); // Sync
+
+      my_msg_t msg
+        { 1, "msg" };
+      ws_mq.send (&msg, sizeof(msg));
+
+      th2.join ();
+      assert (rw.res == result::ok);
+
+      // The message was taken; release the set.
+      ws_sem.post ();
+      th1.join ();
+      assert (ws.res == result::ok);
+    }
+
+    {
+      // The same for a blocked allocator.
+      semaphore ws_sem
+        { "ws_sem3" };
+      memory_pool ws_mp
+        { 1, sizeof(my_blk_t) };
+      void* blk = ws_mp.alloc ();
+
+      wait_set ws4
+        { "ws4" };
+      ws4.add (ws_mp);
+      ws4.add (ws_sem);
+
+      my_ws_wait_t ws
+        { &ws4, nullptr, nullptr, nullptr, ETIMEDOUT };
+      thread th1
+        { "wsw2", wsfunc, &ws };
+      sysclock.sleep_for (1); // Sync
+
+      my_ws_wait_t aw
+        { nullptr, nullptr, &ws_mp, nullptr, ETIMEDOUT };
+      thread th2
+        { "wsa1", mpafunc, &aw };
+      sysclock.sleep_for (1); // Sync
+
+      ws_mp.free (blk);
+
+      th2.join ();
+      assert (aw.blk != nullptr);
+      ws_mp.free (aw.blk);
+
+      ws_sem.post ();
+      th1.join ();
+      assert (ws.res == result::ok);
+    }
+
+  // ==========================================================================
+
+  printf ("\n%s - Single producer, single consumer queues.\n", test_name);
+
+    {
+      spsc_queue<my_msg_t, 4> sq1;
+      spsc_queue<my_msg_t, 4> sq2
+        { "sq2" };
+
+      my_msg_t sq_msg_out
+        { 1, "msg" };
+      my_msg_t sq_msg_in;
+
+      sq1.push (sq_msg_out);
+      sq1.try_pop (sq_msg_in);
+      sq1.push (sq_msg_out);
+      sq1.pop (sq_msg_in);
+      sq1.timed_pop (sq_msg_in, 1);
+
+      sq2.push (sq_msg_out);
+      sq2.length ();
+      sq2.empty ();
+      sq2.full ();
+    }
+
+  // ==========================================================================
+
+  printf ("\n%s - Multiple producers, multiple consumers queues.\n",
+          test_name);
+
+    {
+      mpmc_queue<my_msg_t, 4> lq1;
+      mpmc_queue<my_msg_t, 4> lq2
+        { "lq2" };
+
+      my_msg_t lq_msg_out
+        { 1, "msg" };
+      my_msg_t lq_msg_in;
+
+      lq1.try_push (lq_msg_out);
+      lq1.push (lq_msg_out);
+      lq1.timed_push (lq_msg_out, 1);
+      lq1.try_pop (lq_msg_in);
+      lq1.pop (lq_msg_in);
+      lq1.timed_pop (lq_msg_in, 1);
+
+      lq2.push (lq_msg_out);
+      lq2.length ();
+      lq2.capacity ();
+      lq2.empty ();
+      lq2.full ();
+
+      // Untyped queue, with user storage.
+      static std::max_align_t cells[32];
+      mpmc_queue_base lq3
+        { "lq3", 4, sizeof(my_msg_t), cells, sizeof(cells) };
+      lq3.try_push (&lq_msg_out);
+      lq3.try_pop (&lq_msg_in);
+    }
+
+  // ==========================================================================
+
   printf ("\n%s - Timers.\n", test_name);
 
     {
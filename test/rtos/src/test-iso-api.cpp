@@ -32,6 +32,7 @@
 #include <cmsis-plus/estd/chrono>
 #include <cmsis-plus/estd/condition_variable>
 #include <cmsis-plus/estd/mutex>
+#include <cmsis-plus/estd/shared_mutex>
 #include <cmsis-plus/estd/thread>
 
 // ----------------------------------------------------------------------------
@@ -218,6 +219,51 @@ test_iso_api (bool extra)
           if (mx2.try_lock_until (chrono::realtime_clock::now () + 100ms))
             mx2.unlock ();
 
+#pragma GCC diagnostic pop
+
+        }
+    }
+
+  // ==========================================================================
+  printf ("\n%s - Shared mutexes.\n", test_name);
+
+    {
+        {
+          shared_mutex sm1;
+
+          sm1.lock ();
+          sm1.unlock ();
+
+          sm1.lock_shared ();
+          sm1.try_lock_shared ();
+          sm1.unlock_shared ();
+          sm1.unlock_shared ();
+
+          sm1.try_lock ();
+          sm1.unlock ();
+        }
+
+        {
+          shared_timed_mutex sm2;
+
+          sm2.try_lock_for (systicks (10));
+          sm2.unlock ();
+          sm2.try_lock_shared_for (milliseconds (10));
+          sm2.unlock_shared ();
+
+            {
+              shared_lock<shared_timed_mutex> lock
+                { sm2 };
+            }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Waggregate-return"
+
+          if (sm2.try_lock_until (chrono::systick_clock::now () + 5ms))
+            sm2.unlock ();
+          if (sm2.try_lock_shared_until (chrono::systick_clock::now () + 5ms))
+            sm2.unlock_shared ();
+
 #pragma GCC diagnostic pop
 
         }
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <test.h>
+
+#include <cassert>
+
+using namespace os;
+using namespace os::rtos;
+
+// A host-side stand-in for the port tick suppression: it records the
+// requested sleep length and, when enabled, pretends the device slept
+// until the tick before the deadline, without waiting for real time.
+
+static uint32_t volatile calls;
+static uint32_t volatile first_max_ticks;
+static bool volatile simulate;
+static semaphore_binary* volatile wake;
+
+bool
+os_rtos_idle_suppress_ticks_hook (uint32_t max_ticks, uint32_t* elapsed_ticks)
+{
+  if (calls++ == 0)
+    {
+      first_max_ticks = max_ticks;
+    }
+
+  *elapsed_ticks = 0;
+  if (wake != nullptr)
+    {
+      // Nothing else would wake up the main thread.
+      wake->post ();
+      return false;
+    }
+
+  if (simulate)
+    {
+      // The pending tick is not included.
+      *elapsed_ticks = max_ticks - 1;
+      return true;
+    }
+
+  return false;
+}
+
+static void
+begin_phase (bool simulated)
+{
+  // Align to a tick, so the deadlines are exact.
+  sysclock.sleep_for (1);
+
+  simulate = simulated;
+  calls = 0;
+  first_max_ticks = 0;
+}
+
+int
+run_tests ()
+{
+  // No clock deadline; the sleep is limited only by the simulated RTC.
+  begin_phase (false);
+    {
+      semaphore_binary sem
+        { "sem", 0 };
+      wake = &sem;
+      sem.wait ();
+      wake = nullptr;
+    }
+  printf ("empty list: %u calls, max %u ticks\n",
+          static_cast<unsigned> (calls),
+          static_cast<unsigned> (first_max_ticks));
+  assert (calls > 0);
+  assert (first_max_ticks >= OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS);
+#if !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER)
+  assert (first_max_ticks <= clock_systick::frequency_hz);
+#endif
+
+  // A deadline closer than the minimum; the ticks are not suppressed.
+  begin_phase (false);
+  sysclock.sleep_for (OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS - 1);
+  printf ("near deadline: %u calls\n", static_cast<unsigned> (calls));
+  assert (calls == 0);
+
+  // A deadline just above the minimum.
+  begin_phase (false);
+  sysclock.sleep_for (OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS + 1);
+  printf ("short deadline: %u calls, max %u ticks\n",
+          static_cast<unsigned> (calls),
+          static_cast<unsigned> (first_max_ticks));
+  assert (calls > 0);
+  assert (first_max_ticks <= OS_INTEGER_RTOS_TICKLESS_IDLE_MIN_TICKS + 1);
+
+  // A far deadline; the simulated sleep credits the ticks, and the
+  // thread must wake up exactly at the deadline.
+  constexpr clock::duration_t far = 5 * clock_systick::frequency_hz;
+  begin_phase (true);
+  clock::timestamp_t deadline = sysclock.steady_now () + far;
+  sysclock.sleep_for (far);
+  clock::timestamp_t now = sysclock.steady_now ();
+  simulate = false;
+  printf ("far deadline: %u calls, max %u ticks, woke at %+d\n",
+          static_cast<unsigned> (calls),
+          static_cast<unsigned> (first_max_ticks),
+          static_cast<int> (now - deadline));
+  assert (calls > 0);
+#if !defined(OS_INCLUDE_RTOS_REALTIME_CLOCK_DRIVER)
+  // At least one wake-up per second.
+  assert (calls >= far / clock_systick::frequency_hz);
+  assert (first_max_ticks <= clock_systick::frequency_hz);
+#else
+  assert (first_max_ticks == far);
+#endif
+  assert (now >= deadline);
+  assert (now - deadline <= 1);
+
+  puts ("Done.");
+  return 0;
+}